@@ -7,6 +7,13 @@ using namespace common;
 
 namespace binder {
 
+Value ParameterExpression::getValue() const {
+    if (*source->getDataType() == *value.getDataType()) {
+        return *source;
+    }
+    return value;
+}
+
 void ParameterExpression::cast(const LogicalType& type) {
     if (!dataType.containsAny()) {
         // LCOV_EXCL_START
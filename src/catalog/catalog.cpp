@@ -327,6 +327,10 @@ std::vector<std::string> Catalog::getMacroNames(Transaction* transaction) const
     return macroNames;
 }
 
+uint64_t Catalog::getVersion() const {
+    return tables->getVersion() + sequences->getVersion() + functions->getVersion();
+}
+
 void Catalog::prepareCheckpoint(const std::string& databasePath, WAL* wal, VirtualFileSystem* fs) {
     saveToFile(databasePath, fs, common::FileVersionType::WAL_VERSION);
     wal->logCatalogRecord();
@@ -59,6 +59,7 @@ void CatalogSet::createEntry(Transaction* transaction, std::unique_ptr<CatalogEn
 }
 
 void CatalogSet::emplace(std::unique_ptr<CatalogEntry> entry) {
+    incrementVersion();
     if (entries.contains(entry->getName())) {
         entry->setPrev(std::move(entries.at(entry->getName())));
         entries.erase(entry->getName());
@@ -67,6 +68,7 @@ void CatalogSet::emplace(std::unique_ptr<CatalogEntry> entry) {
 }
 
 void CatalogSet::erase(const std::string& name) {
+    incrementVersion();
     entries.erase(name);
 }
 
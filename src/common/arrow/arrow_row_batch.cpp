@@ -1,12 +1,20 @@
 #include "common/arrow/arrow_row_batch.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 #include "common/exception/runtime.h"
+#include "common/null_buffer.h"
 #include "common/types/uuid.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -940,7 +948,278 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+static bool canCopyFromRowLayout(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::INTERVAL:
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::UUID:
+    case LogicalTypeID::STRING:
+        return true;
+    case LogicalTypeID::LIST:
+        return canCopyFromRowLayout(ListType::getChildType(type));
+    default:
+        return false;
+    }
+}
+
+static void setNull(ArrowVector* vector, std::int64_t pos) {
+    setBitToZero(vector->validity.data(), pos);
+    vector->numNulls++;
+}
+
+// A named type (rather than a lambda) so that copying nested lists doesn't instantiate
+// copyFromRowLayout recursively with new types.
+struct ListElementIsNull {
+    const uint8_t* nullBytes;
+
+    bool operator()(uint64_t idx) const { return NullBuffer::isNull(nullBytes, idx); }
+};
+
+// Appends numValues values stored in row layout, i.e. the value at index i is stored at
+// values + i * stride. IS_NULL(i) returns whether the value at index i is null.
+template<typename IS_NULL>
+static void copyFromRowLayout(ArrowVector* vector, const LogicalType& type, const uint8_t* values,
+    uint64_t stride, uint64_t numValues, IS_NULL isNull) {
+    auto startPos = vector->numValues;
+    resizeVector(vector, type, startPos + numValues);
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        for (auto i = 0u; i < numValues; i++) {
+            if (isNull(i)) {
+                setNull(vector, startPos + i);
+            } else if (*(bool*)(values + i * stride)) {
+                setBitToOne(vector->data.data(), startPos + i);
+            } else {
+                setBitToZero(vector->data.data(), startPos + i);
+            }
+        }
+    } break;
+    case LogicalTypeID::INTERVAL: {
+        auto dst = (int64_t*)vector->data.data() + startPos;
+        for (auto i = 0u; i < numValues; i++) {
+            if (isNull(i)) {
+                setNull(vector, startPos + i);
+                continue;
+            }
+            auto interval = *(interval_t*)(values + i * stride);
+            dst[i] = interval.micros + interval.days * Interval::MICROS_PER_DAY +
+                     interval.months * Interval::MICROS_PER_MONTH;
+        }
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        // Size the overflow buffer once for the whole batch of strings.
+        auto offsets = (std::uint32_t*)vector->data.data();
+        if (startPos == 0) {
+            offsets[0] = 0;
+        }
+        uint64_t totalLength = 0;
+        for (auto i = 0u; i < numValues; i++) {
+            if (!isNull(i)) {
+                totalLength += ((ku_string_t*)(values + i * stride))->len;
+            }
+        }
+        vector->overflow.resize(offsets[startPos] + totalLength + 1);
+        for (auto i = 0u; i < numValues; i++) {
+            auto pos = startPos + i;
+            if (isNull(i)) {
+                offsets[pos + 1] = offsets[pos];
+                setNull(vector, pos);
+                continue;
+            }
+            auto str = (ku_string_t*)(values + i * stride);
+            std::memcpy(vector->overflow.data() + offsets[pos], str->getData(), str->len);
+            offsets[pos + 1] = offsets[pos] + str->len;
+        }
+    } break;
+    case LogicalTypeID::UUID: {
+        auto offsets = (std::uint32_t*)vector->data.data();
+        if (startPos == 0) {
+            offsets[0] = 0;
+        }
+        vector->overflow.resize(offsets[startPos] + numValues * UUID::UUID_STRING_LENGTH + 1);
+        for (auto i = 0u; i < numValues; i++) {
+            auto pos = startPos + i;
+            if (isNull(i)) {
+                offsets[pos + 1] = offsets[pos];
+                setNull(vector, pos);
+                continue;
+            }
+            UUID::toString(((ku_uuid_t*)(values + i * stride))->value,
+                (char*)vector->overflow.data() + offsets[pos]);
+            offsets[pos + 1] = offsets[pos] + UUID::UUID_STRING_LENGTH;
+        }
+    } break;
+    case LogicalTypeID::LIST: {
+        // Elements of a list are stored contiguously after the null bits of the list, so each list
+        // is appended to the child vector in one batch.
+        auto childType = ListType::getChildType(type);
+        auto childStride = LogicalTypeUtils::getRowLayoutSize(childType);
+        auto offsets = (std::uint32_t*)vector->data.data();
+        if (startPos == 0) {
+            offsets[0] = 0;
+        }
+        for (auto i = 0u; i < numValues; i++) {
+            auto pos = startPos + i;
+            if (isNull(i)) {
+                offsets[pos + 1] = offsets[pos];
+                setNull(vector, pos);
+                continue;
+            }
+            auto list = (ku_list_t*)(values + i * stride);
+            offsets[pos + 1] = offsets[pos] + list->size;
+            auto listNullBytes = reinterpret_cast<const uint8_t*>(list->overflowPtr);
+            auto listValues = listNullBytes + NullBuffer::getNumBytesForNullValues(list->size);
+            copyFromRowLayout(vector->childData[0].get(), childType, listValues, childStride,
+                list->size, ListElementIsNull{listNullBytes});
+        }
+    } break;
+    default: {
+        KU_ASSERT(canCopyFromRowLayout(type));
+        auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+        auto dst = vector->data.data() + startPos * valSize;
+        for (auto i = 0u; i < numValues; i++) {
+            std::memcpy(dst + i * valSize, values + i * stride, valSize);
+        }
+        for (auto i = 0u; i < numValues; i++) {
+            if (isNull(i)) {
+                setNull(vector, startPos + i);
+            }
+        }
+    }
+    }
+    vector->numValues += numValues;
+}
+
+static void copyColumnFromTable(ArrowVector* vector, const LogicalType& type,
+    const processor::FactorizedTable& table, processor::ft_col_idx_t colIdx,
+    processor::ft_tuple_idx_t startTupleIdx, uint64_t numTuples) {
+    auto tableSchema = table.getTableSchema();
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    auto colOffset = tableSchema->getColOffset(colIdx);
+    auto nullMapOffset = tableSchema->getNullMapOffset();
+    auto mayContainNulls = !table.hasNoNullGuarantee(colIdx);
+    auto tupleIdx = startTupleIdx;
+    auto endTupleIdx = startTupleIdx + numTuples;
+    // Tuples are contiguous within a block
+    while (tupleIdx < endTupleIdx) {
+        auto numTuplesInBlock = std::min<uint64_t>(endTupleIdx - tupleIdx,
+            table.getNumTuplesPerBlock() - tupleIdx % table.getNumTuplesPerBlock());
+        auto tuples = table.getTuple(tupleIdx);
+        if (mayContainNulls) {
+            copyFromRowLayout(vector, type, tuples + colOffset, numBytesPerTuple,
+                numTuplesInBlock, [&](uint64_t i) {
+                    return NullBuffer::isNull(tuples + i * numBytesPerTuple + nullMapOffset,
+                        colIdx);
+                });
+        } else {
+            copyFromRowLayout(vector, type, tuples + colOffset, numBytesPerTuple,
+                numTuplesInBlock, [](uint64_t) { return false; });
+        }
+        tupleIdx += numTuplesInBlock;
+    }
+}
+
+// Columns are copied by separate threads once a chunk is large enough to amortize starting them.
+static constexpr uint64_t MIN_NUM_TUPLES_TO_COPY_COLUMNS_IN_PARALLEL = 1 << 16;
+
+// Runs copyColumn on each column, using up to numThreads threads including the calling one. The
+// first exception thrown by any of them is rethrown once all threads are done.
+template<typename FUNC>
+static void copyColumnsInParallel(uint64_t numColumns, uint64_t numThreads, FUNC copyColumn) {
+    std::atomic<uint64_t> nextColumn = 0;
+    std::mutex mtx;
+    std::exception_ptr exception;
+    auto copyNextColumns = [&]() {
+        try {
+            for (auto col = nextColumn++; col < numColumns; col = nextColumn++) {
+                copyColumn(col);
+            }
+        } catch (...) {
+            std::unique_lock<std::mutex> lck{mtx};
+            if (exception == nullptr) {
+                exception = std::current_exception();
+            }
+            // Other threads stop at their next column.
+            nextColumn = numColumns;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < numThreads; i++) {
+        try {
+            threads.emplace_back(copyNextColumns);
+        } catch (std::system_error&) {
+            // The columns left are copied by the threads already started.
+            break;
+        }
+    }
+    copyNextColumns();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
+ArrowArray ArrowRowBatch::appendColumns(main::QueryResult& queryResult, std::int64_t chunkSize) {
+    std::int64_t numTuplesInBatch = 0;
+    // A streamed result is read one chunk table after another.
+    while (numTuplesInBatch < chunkSize && queryResult.hasNext()) {
+        queryResult.fetchNextChunkIfNecessary();
+        numTuplesInBatch += copyColumns(*queryResult.factorizedTable, *queryResult.iterator,
+            chunkSize - numTuplesInBatch, queryResult.numThreads);
+    }
+    numTuples += numTuplesInBatch;
+    return toArray();
+}
+
+uint64_t ArrowRowBatch::copyColumns(const processor::FactorizedTable& table,
+    processor::FlatTupleIterator& iterator, uint64_t maxNumTuples, uint64_t maxNumThreads) {
+    auto startTupleIdx = std::min(iterator.getNextTupleIdxOfFlatTable(), table.getNumTuples());
+    auto numTuplesInBatch = std::min(maxNumTuples, table.getNumTuples() - startTupleIdx);
+    auto numColumns = types.size();
+    auto numThreads = std::min<uint64_t>(numColumns, maxNumThreads);
+    if (numTuplesInBatch < MIN_NUM_TUPLES_TO_COPY_COLUMNS_IN_PARALLEL) {
+        numThreads = 1;
+    }
+    copyColumnsInParallel(numColumns, numThreads, [&](uint64_t col) {
+        copyColumnFromTable(vectors[col].get(), types[col], table, col, startTupleIdx,
+            numTuplesInBatch);
+    });
+    iterator.skipTuplesOfFlatTable(numTuplesInBatch);
+    return numTuplesInBatch;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
+    queryResult.validateQuerySucceed();
+    if (!queryResult.hasNext()) {
+        return toArray();
+    }
+    queryResult.fetchNextChunkIfNecessary();
+    if (!queryResult.factorizedTable->hasUnflatCol() &&
+        std::all_of(types.begin(), types.end(), canCopyFromRowLayout)) {
+        return appendColumns(queryResult, chunkSize);
+    }
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
     while (numTuplesInBatch < chunkSize) {
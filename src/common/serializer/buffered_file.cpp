@@ -2,7 +2,6 @@
 
 #include <cstring>
 
-#include "common/assert.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/file_info.h"
 
@@ -17,21 +16,17 @@ BufferedFileWriter::BufferedFileWriter(std::unique_ptr<FileInfo> fileInfo)
     : buffer(std::make_unique<uint8_t[]>(BUFFER_SIZE)), fileOffset(0), bufferOffset(0),
       fileInfo(std::move(fileInfo)) {}
 
-// TODO: write assumes size is always less than BUFFER_SIZE here. should change this when needed.
 void BufferedFileWriter::write(const uint8_t* data, uint64_t size) {
-    KU_ASSERT(size <= BUFFER_SIZE);
-    if (bufferOffset + size <= BUFFER_SIZE) {
-        memcpy(&buffer[bufferOffset], data, size);
-        bufferOffset += size;
-    } else {
+    while (bufferOffset + size > BUFFER_SIZE) {
         auto toCopy = BUFFER_SIZE - bufferOffset;
         memcpy(&buffer[bufferOffset], data, toCopy);
         bufferOffset += toCopy;
         flush();
-        auto remaining = size - toCopy;
-        memcpy(buffer.get(), data + toCopy, remaining);
-        bufferOffset += remaining;
+        data += toCopy;
+        size -= toCopy;
     }
+    memcpy(&buffer[bufferOffset], data, size);
+    bufferOffset += size;
 }
 
 void BufferedFileWriter::flush() {
@@ -56,18 +51,16 @@ BufferedFileReader::BufferedFileReader(std::unique_ptr<FileInfo> fileInfo)
 }
 
 void BufferedFileReader::read(uint8_t* data, uint64_t size) {
-    if (bufferOffset + size <= BUFFER_SIZE) {
-        memcpy(data, &buffer[bufferOffset], size);
-        bufferOffset += size;
-    } else {
+    while (bufferOffset + size > BUFFER_SIZE) {
         auto toCopy = BUFFER_SIZE - bufferOffset;
         memcpy(data, &buffer[bufferOffset], toCopy);
         bufferOffset += toCopy;
         readNextPage();
-        auto remaining = size - toCopy;
-        memcpy(data + toCopy, buffer.get(), remaining);
-        bufferOffset += remaining;
+        data += toCopy;
+        size -= toCopy;
     }
+    memcpy(data, &buffer[bufferOffset], size);
+    bufferOffset += size;
 }
 
 bool BufferedFileReader::finished() {
@@ -22,7 +22,11 @@ TaskScheduler::~TaskScheduler() {
 }
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
-    processor::ExecutionContext* context) {
+    processor::ExecutionContext* context, bool runChildrenConcurrently) {
+    if (runChildrenConcurrently && !task->children.empty()) {
+        scheduleTaskTreeAndWaitOrError(task, context);
+        return;
+    }
     for (auto& dependency : task->children) {
         scheduleTaskAndWaitOrError(dependency, context);
     }
@@ -40,8 +44,9 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
             taskLck.unlock();
             break;
         }
-        if (context->clientContext->hasTimeout()) {
-            timeout = context->clientContext->getTimeoutRemainingInMS();
+        if (context->clientConfig.timeoutInMS != 0) {
+            timeout =
+                context->clientContext->getTimeoutRemainingInMS(context->clientConfig.timeoutInMS);
             if (timeout == 0) {
                 context->clientContext->interrupt();
             } else {
@@ -64,8 +69,112 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
 }
 
+static void collectTasks(const std::shared_ptr<Task>& task,
+    std::vector<std::shared_ptr<Task>>& tasks) {
+    for (auto& child : task->children) {
+        collectTasks(child, tasks);
+    }
+    tasks.push_back(task);
+}
+
+static bool canBeScheduled(const Task& task) {
+    for (auto& child : task.children) {
+        if (!child->isCompletedSuccessfully()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TaskScheduler::scheduleTaskTreeAndWaitOrError(const std::shared_ptr<Task>& task,
+    processor::ExecutionContext* context) {
+    // Tasks in post order, so that a task comes after its children and the queue order is the
+    // same as if the tasks were scheduled one after another.
+    std::vector<std::shared_ptr<Task>> pendingTasks;
+    collectTasks(task, pendingTasks);
+    std::vector<std::shared_ptr<ScheduledTask>> scheduledTasks;
+    std::shared_ptr<Task> erroringTask = nullptr;
+    lock_t lck{mtx};
+    while (true) {
+        auto numScheduledTasks = scheduledTasks.size();
+        for (auto it = pendingTasks.begin(); it != pendingTasks.end();) {
+            if (canBeScheduled(**it)) {
+                scheduledTasks.push_back(pushTaskIntoQueueNoLock(*it));
+                it = pendingTasks.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (scheduledTasks.size() > numScheduledTasks) {
+            cv.notify_all();
+        }
+        if (task->isCompletedSuccessfully()) {
+            break;
+        }
+        for (auto& scheduledTask : scheduledTasks) {
+            if (scheduledTask->task->hasException()) {
+                erroringTask = scheduledTask->task;
+                break;
+            }
+        }
+        if (erroringTask != nullptr) {
+            break;
+        }
+        bool timedWait = false;
+        auto timeout = 0u;
+        if (context->clientConfig.timeoutInMS != 0) {
+            timeout =
+                context->clientContext->getTimeoutRemainingInMS(context->clientConfig.timeoutInMS);
+            if (timeout == 0) {
+                context->clientContext->interrupt();
+            } else {
+                timedWait = true;
+            }
+        }
+        if (timedWait) {
+            taskFinishedCV.wait_for(lck, std::chrono::milliseconds(timeout));
+        } else {
+            taskFinishedCV.wait(lck);
+        }
+    }
+    if (erroringTask == nullptr) {
+        return;
+    }
+    // Interrupt other tasks, so they stop early. Tasks that no thread has registered to are
+    // dropped from the queue. Then wait for the threads working on the rest of the tasks.
+    context->clientContext->interrupt();
+    auto exceptionPtr = erroringTask->getExceptionPtr();
+    for (auto& scheduledTask : scheduledTasks) {
+        auto& scheduled = *scheduledTask->task;
+        lock_t taskLck{scheduled.mtx};
+        if (scheduled.numThreadsRegistered == 0) {
+            scheduled.setExceptionNoLock(exceptionPtr);
+        }
+    }
+    taskFinishedCV.wait(lck, [&] {
+        for (auto& scheduledTask : scheduledTasks) {
+            auto& scheduled = *scheduledTask->task;
+            lock_t taskLck{scheduled.mtx};
+            if (scheduled.numThreadsRegistered > 0 && !scheduled.isCompletedNoLock()) {
+                return false;
+            }
+        }
+        return true;
+    });
+    for (auto& scheduledTask : scheduledTasks) {
+        removeTaskNoLock(scheduledTask->ID);
+    }
+    lck.unlock();
+    std::rethrow_exception(exceptionPtr);
+}
+
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{mtx};
+    return pushTaskIntoQueueNoLock(task);
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueueNoLock(
+    const std::shared_ptr<Task>& task) {
     auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
     taskQueue.push_back(scheduledTask);
     return scheduledTask;
@@ -99,6 +208,10 @@ std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
     lock_t lck{mtx};
+    removeTaskNoLock(scheduledTaskID);
+}
+
+void TaskScheduler::removeTaskNoLock(uint64_t scheduledTaskID) {
     for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
             taskQueue.erase(it);
@@ -126,8 +239,12 @@ void TaskScheduler::runWorkerThread() {
         } catch (std::exception& e) {
             scheduledTask->task->setException(std::current_exception());
             scheduledTask->task->deRegisterThreadAndFinalizeTask();
-            continue;
         }
+        // Wake up scheduleTaskTreeAndWaitOrError(), which may be able to schedule the parent
+        // task. Taking the lock makes sure the notification is not lost.
+        lck.lock();
+        lck.unlock();
+        taskFinishedCV.notify_all();
     }
 }
 } // namespace common
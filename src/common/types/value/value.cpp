@@ -873,6 +873,8 @@ std::unique_ptr<Value> Value::deserialize(Deserializer& deserializer) {
     case PhysicalTypeID::ARRAY:
     case PhysicalTypeID::LIST:
     case PhysicalTypeID::STRUCT: {
+        // The default value of a struct already holds a child for each field.
+        val->children.clear();
         val->children.reserve(val->childrenSize);
         for (auto i = 0u; i < val->childrenSize; i++) {
             val->children.push_back(deserialize(deserializer));
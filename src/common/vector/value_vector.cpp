@@ -184,6 +184,9 @@ void ValueVector::copyFromValue(uint64_t pos, const Value& value) {
     case PhysicalTypeID::INTERVAL: {
         memcpy(dstValue, &value.val.intervalVal, numBytesPerValue);
     } break;
+    case PhysicalTypeID::INTERNAL_ID: {
+        memcpy(dstValue, &value.val.internalIDVal, numBytesPerValue);
+    } break;
     case PhysicalTypeID::STRING: {
         StringVector::addString(this, *(ku_string_t*)dstValue, value.strVal.data(),
             value.strVal.length());
@@ -260,6 +263,9 @@ std::unique_ptr<Value> ValueVector::getAsValue(uint64_t pos) const {
     case PhysicalTypeID::INTERVAL: {
         value->val.intervalVal = getValue<interval_t>(pos);
     } break;
+    case PhysicalTypeID::INTERNAL_ID: {
+        value->val.internalIDVal = getValue<internalID_t>(pos);
+    } break;
     case PhysicalTypeID::STRING: {
         value->strVal = getValue<ku_string_t>(pos).getAsString();
     } break;
@@ -31,7 +31,7 @@ void FunctionExpressionEvaluator::evaluate(ClientContext* clientContext) {
 }
 
 bool FunctionExpressionEvaluator::select(SelectionVector& selVector,
-    ClientContext* /*ClientContext*/) {
+    ClientContext* clientContext) {
     for (auto& child : children) {
         child->evaluate(nullptr);
     }
@@ -39,7 +39,9 @@ bool FunctionExpressionEvaluator::select(SelectionVector& selVector,
     // implemented (e.g. list_contains). We should remove this if statement eventually.
     if (selectFunc == nullptr) {
         KU_ASSERT(resultVector->dataType.getLogicalTypeID() == LogicalTypeID::BOOL);
-        execFunc(parameters, *resultVector, nullptr);
+        auto bindData = expression->constPtrCast<binder::ScalarFunctionExpression>()->getBindData();
+        bindData->clientContext = clientContext;
+        execFunc(parameters, *resultVector, bindData);
         auto numSelectedValues = 0u;
         for (auto i = 0u; i < resultVector->state->getSelVector().getSelSize(); ++i) {
             auto pos = resultVector->state->getSelVector()[i];
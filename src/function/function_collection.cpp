@@ -214,7 +214,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(ShowTablesFunction), TABLE_FUNCTION(TableInfoFunction),
         TABLE_FUNCTION(ShowConnectionFunction), TABLE_FUNCTION(StorageInfoFunction),
         TABLE_FUNCTION(ShowAttachedDatabasesFunction), TABLE_FUNCTION(CheckpointFunction),
-        TABLE_FUNCTION(ShowSequencesFunction),
+        TABLE_FUNCTION(ShowSequencesFunction), TABLE_FUNCTION(CheckpointInfoFunction),
+        TABLE_FUNCTION(BufferManagerInfoFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
@@ -1,3 +1,11 @@
+#include <atomic>
+#include <condition_variable>
+
+#include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
 #include "function/gds/gds.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds_function.h"
@@ -13,21 +21,273 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace function {
 
+// PULL computes the rank of each node by reading the contributions of its neighbours. PUSH scatters
+// the contribution of each node to the nodes it contributes to, which favours graphs whose nodes
+// have few but hot neighbours. Both variants compute the same ranks.
+enum class PageRankVariant : uint8_t {
+    PULL = 0,
+    PUSH = 1,
+};
+
 struct PageRankBindData final : public GDSBindData {
     double dampingFactor = 0.85;
     int64_t maxIteration = 10;
     double delta = 0.0001; // detect convergence
+    PageRankVariant variant;
 
-    PageRankBindData() = default;
+    explicit PageRankBindData(PageRankVariant variant) : variant{variant} {}
 
     std::unique_ptr<GDSBindData> copy() const override {
-        return std::make_unique<PageRankBindData>();
+        return std::make_unique<PageRankBindData>(variant);
+    }
+};
+
+// Page rank is computed in phases. Each phase is split into morsels of node offsets which are
+// processed concurrently by all threads working on the GDS call. A phase starts only after all
+// morsels of the previous phase are finished.
+enum class PageRankPhase : uint8_t {
+    // Initialize ranks and, for PUSH, the reversed adjacency lists. Single morsel.
+    INIT = 0,
+    // One pull iteration.
+    PULL = 1,
+    // Scatter step of one push iteration.
+    PUSH = 2,
+    // Apply step of one push iteration, which turns accumulated contributions into ranks.
+    APPLY = 3,
+    // Append ranks to the result table.
+    MATERIALIZE = 4,
+    DONE = 5,
+};
+
+// Threads read neighbours from the graph concurrently, which relies on the graph being in memory.
+class PageRankSharedState final : public GDSSharedState {
+    static constexpr offset_t MORSEL_SIZE = 2048;
+
+public:
+    PageRankSharedState(graph::Graph* graph, const PageRankBindData& bindData)
+        : graph{graph}, numNodes{graph->getNumNodes()}, hasWeights{graph->hasWeights()},
+          bindData{bindData} {}
+
+    // Assigns the next morsel [startOffset, endOffset) of the current phase to the calling thread.
+    // Blocks if the current phase has no morsel left but is not finished yet. Returns false once
+    // the computation is done.
+    bool getMorsel(PageRankPhase& phase_, offset_t& startOffset, offset_t& endOffset) {
+        std::unique_lock lck{mtx};
+        while (true) {
+            if (phase == PageRankPhase::DONE) {
+                return false;
+            }
+            if (nextOffset < numNodes) {
+                auto morselSize = phase == PageRankPhase::INIT ? numNodes : MORSEL_SIZE;
+                phase_ = phase;
+                startOffset = nextOffset;
+                endOffset = std::min(numNodes, nextOffset + morselSize);
+                nextOffset = endOffset;
+                numActiveMorsels++;
+                return true;
+            }
+            if (numActiveMorsels == 0) {
+                // Phase without any morsel, e.g. on an empty graph.
+                finishPhaseNoLock();
+                continue;
+            }
+            auto currentPhase = phase;
+            cv.wait(lck, [&] { return phase != currentPhase; });
+        }
+    }
+
+    // `change` is the partial sum of rank changes computed by the calling thread on its morsel.
+    void finishMorsel(double change) {
+        std::unique_lock lck{mtx};
+        totalChange += change;
+        numActiveMorsels--;
+        if (numActiveMorsels == 0 && nextOffset >= numNodes) {
+            finishPhaseNoLock();
+        }
+    }
+
+    // Stops all threads, e.g. when one of them hits an exception.
+    void terminate() {
+        std::unique_lock lck{mtx};
+        phase = PageRankPhase::DONE;
+        cv.notify_all();
+    }
+
+    void init() {
+        if (bindData.variant == PageRankVariant::PUSH) {
+            // A node pushes its contribution to the nodes having it as neighbour, so we need the
+            // reversed adjacency lists.
+            reversedCSROffsets.resize(numNodes + 1, 0);
+            for (auto offset = 0u; offset < numNodes; ++offset) {
+                for (auto nbrOffset : graph->getNbrOffsets(offset)) {
+                    reversedCSROffsets[nbrOffset + 1]++;
+                }
+            }
+            for (auto offset = 0u; offset < numNodes; ++offset) {
+                reversedCSROffsets[offset + 1] += reversedCSROffsets[offset];
+            }
+            reversedNbrOffsets.resize(reversedCSROffsets[numNodes]);
+            if (hasWeights) {
+                reversedWeights.resize(reversedCSROffsets[numNodes]);
+            }
+            std::vector<offset_t> positions{reversedCSROffsets.begin(),
+                reversedCSROffsets.end() - 1};
+            for (auto offset = 0u; offset < numNodes; ++offset) {
+                auto nbrOffsets = graph->getNbrOffsets(offset);
+                auto weights = graph->getNbrWeights(offset);
+                for (auto i = 0u; i < nbrOffsets.size(); ++i) {
+                    auto pos = positions[nbrOffsets[i]]++;
+                    reversedNbrOffsets[pos] = offset;
+                    if (hasWeights) {
+                        reversedWeights[pos] = weights[i];
+                    }
+                }
+            }
+            accumulators = std::vector<std::atomic<double>>(numNodes);
+        }
+        totalWeights.resize(numNodes);
+        ranks.resize(numNodes);
+        contributions.resize(numNodes);
+        nextContributions.resize(numNodes);
+        for (auto offset = 0u; offset < numNodes; ++offset) {
+            totalWeights[offset] = computeTotalWeight(offset);
+            ranks[offset] = (double)1 / numNodes;
+            contributions[offset] = ranks[offset] / totalWeights[offset];
+        }
+    }
+
+    double pull(offset_t startOffset, offset_t endOffset) {
+        auto change = 0.0;
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            auto sum = 0.0;
+            auto nbrOffsets = graph->getNbrOffsets(offset);
+            if (hasWeights) {
+                auto weights = graph->getNbrWeights(offset);
+                for (auto i = 0u; i < nbrOffsets.size(); ++i) {
+                    sum += contributions[nbrOffsets[i]] * weights[i];
+                }
+            } else {
+                for (auto nbrOffset : nbrOffsets) {
+                    sum += contributions[nbrOffset];
+                }
+            }
+            change += updateRank(offset, sum, nextContributions);
+        }
+        return change;
     }
+
+    void push(offset_t startOffset, offset_t endOffset) {
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            auto contribution = contributions[offset];
+            for (auto i = reversedCSROffsets[offset]; i < reversedCSROffsets[offset + 1]; ++i) {
+                auto weightedContribution =
+                    hasWeights ? contribution * reversedWeights[i] : contribution;
+                accumulators[reversedNbrOffsets[i]].fetch_add(weightedContribution,
+                    std::memory_order_relaxed);
+            }
+        }
+    }
+
+    double apply(offset_t startOffset, offset_t endOffset) {
+        auto change = 0.0;
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
+            auto sum = accumulators[offset].exchange(0, std::memory_order_relaxed);
+            // All contributions of this iteration have been pushed, so we can update in place.
+            change += updateRank(offset, sum, contributions);
+        }
+        return change;
+    }
+
+    const std::vector<double>& getRanks() const { return ranks; }
+
+public:
+    std::mutex mtx;
+
+private:
+    // The rank of a node is split among its neighbours in proportion to the edge weights, or
+    // evenly if the graph has no weights. Nodes without neighbours, or whose edges have no positive
+    // total weight, split it among all nodes.
+    double computeTotalWeight(offset_t offset) const {
+        auto totalWeight = 0.0;
+        if (hasWeights) {
+            for (auto weight : graph->getNbrWeights(offset)) {
+                totalWeight += weight;
+            }
+        } else {
+            totalWeight = graph->getNbrOffsets(offset).size();
+        }
+        return totalWeight > 0 ? totalWeight : numNodes;
+    }
+
+    double updateRank(offset_t offset, double sum, std::vector<double>& contributionsToUpdate) {
+        auto rank = bindData.dampingFactor * sum + (1 - bindData.dampingFactor) / numNodes;
+        double diff = ranks[offset] - rank;
+        ranks[offset] = rank;
+        contributionsToUpdate[offset] = rank / totalWeights[offset];
+        return diff < 0 ? -diff : diff;
+    }
+
+    void finishPhaseNoLock() {
+        switch (phase) {
+        case PageRankPhase::INIT: {
+            phase = bindData.variant == PageRankVariant::PULL ? PageRankPhase::PULL :
+                                                                PageRankPhase::PUSH;
+        } break;
+        case PageRankPhase::PULL: {
+            contributions.swap(nextContributions);
+            phase = finishIterationNoLock() ? PageRankPhase::MATERIALIZE : PageRankPhase::PULL;
+        } break;
+        case PageRankPhase::PUSH: {
+            phase = PageRankPhase::APPLY;
+        } break;
+        case PageRankPhase::APPLY: {
+            phase = finishIterationNoLock() ? PageRankPhase::MATERIALIZE : PageRankPhase::PUSH;
+        } break;
+        case PageRankPhase::MATERIALIZE: {
+            phase = PageRankPhase::DONE;
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+        totalChange = 0;
+        nextOffset = 0;
+        cv.notify_all();
+    }
+
+    // Returns true if page rank has converged or reached the maximum number of iterations.
+    bool finishIterationNoLock() {
+        numIterations++;
+        return totalChange < bindData.delta || numIterations >= bindData.maxIteration;
+    }
+
+private:
+    graph::Graph* graph;
+    offset_t numNodes;
+    bool hasWeights;
+    PageRankBindData bindData;
+    // Phase dispatching.
+    std::condition_variable cv;
+    PageRankPhase phase = PageRankPhase::INIT;
+    offset_t nextOffset = 0;
+    uint64_t numActiveMorsels = 0;
+    int64_t numIterations = 0;
+    double totalChange = 0;
+    // Reversed adjacency lists, only used by PUSH.
+    std::vector<offset_t> reversedCSROffsets;
+    std::vector<offset_t> reversedNbrOffsets;
+    std::vector<double> reversedWeights;
+    // Computation state. The contribution of a node is its rank divided by the total weight of its
+    // edges, which is its out-degree if the graph has no weights.
+    std::vector<double> totalWeights;
+    std::vector<double> ranks;
+    std::vector<double> contributions;
+    std::vector<double> nextContributions;
+    std::vector<std::atomic<double>> accumulators;
 };
 
 class PageRankLocalState : public GDSLocalState {
 public:
-    explicit PageRankLocalState(main::ClientContext* context) {
+    PageRankLocalState(main::ClientContext* context, const FactorizedTable& table) {
         auto mm = context->getMemoryManager();
         nodeIDVector = std::make_unique<ValueVector>(*LogicalType::INTERNAL_ID(), mm);
         rankVector = std::make_unique<ValueVector>(*LogicalType::DOUBLE(), mm);
@@ -35,29 +295,38 @@ public:
         rankVector->state = DataChunkState::getSingleValueDataChunkState();
         vectors.push_back(nodeIDVector.get());
         vectors.push_back(rankVector.get());
+        localTable = std::make_unique<FactorizedTable>(mm, table.getTableSchema()->copy());
     }
 
-    void materialize(graph::Graph* graph, const std::vector<double>& ranks,
-        FactorizedTable& table) const {
-        for (auto offset = 0u; offset < graph->getNumNodes(); ++offset) {
+    void materialize(graph::Graph* graph, const std::vector<double>& ranks, offset_t startOffset,
+        offset_t endOffset) const {
+        for (auto offset = startOffset; offset < endOffset; ++offset) {
             nodeIDVector->setValue<nodeID_t>(0, {offset, graph->getNodeTableID()});
             rankVector->setValue<double>(0, ranks[offset]);
-            table.append(vectors);
+            localTable->append(vectors);
         }
     }
 
+    FactorizedTable* getLocalTable() const { return localTable.get(); }
+
 private:
     std::unique_ptr<ValueVector> nodeIDVector;
     std::unique_ptr<ValueVector> rankVector;
     std::vector<ValueVector*> vectors;
+    std::unique_ptr<FactorizedTable> localTable;
 };
 
 class PageRank final : public GDSAlgorithm {
 public:
-    PageRank() = default;
-    PageRank(const PageRank& other) : GDSAlgorithm{other} {}
+    explicit PageRank(bool hasVariantParameter = false)
+        : hasVariantParameter{hasVariantParameter} {}
+    PageRank(const PageRank& other)
+        : GDSAlgorithm{other}, hasVariantParameter{other.hasVariantParameter} {}
 
     std::vector<common::LogicalTypeID> getParameterTypeIDs() const override {
+        if (hasVariantParameter) {
+            return {LogicalTypeID::ANY, LogicalTypeID::STRING};
+        }
         return {LogicalTypeID::ANY};
     }
 
@@ -67,59 +336,86 @@ public:
         return {*LogicalType::INTERNAL_ID(), *LogicalType::DOUBLE()};
     }
 
-    void bind(const binder::expression_vector&) override {
-        bindData = std::make_unique<PageRankBindData>();
+    void bind(const binder::expression_vector& params) override {
+        auto variant = PageRankVariant::PULL;
+        if (hasVariantParameter) {
+            ExpressionUtil::validateExpressionType(*params[1], ExpressionType::LITERAL);
+            auto variantStr = StringUtils::getUpper(
+                params[1]->constCast<LiteralExpression>().getValue().getValue<std::string>());
+            if (variantStr == "PUSH") {
+                variant = PageRankVariant::PUSH;
+            } else if (variantStr != "PULL") {
+                throw BinderException(stringFormat(
+                    "Unrecognized page rank variant {}. Expect either PULL or PUSH.", variantStr));
+            }
+        }
+        bindData = std::make_unique<PageRankBindData>(variant);
+    }
+
+    bool isParallel() const override { return true; }
+
+    bool readsWeights() const override { return true; }
+
+    std::shared_ptr<GDSSharedState> createSharedState(graph::Graph* graph_) const override {
+        return std::make_shared<PageRankSharedState>(graph_,
+            *bindData->ptrCast<PageRankBindData>());
     }
 
     void initLocalState(main::ClientContext* context) override {
-        localState = std::make_unique<PageRankLocalState>(context);
+        localState = std::make_unique<PageRankLocalState>(context, *table);
     }
 
     void exec() override {
-        auto extraData = bindData->ptrCast<PageRankBindData>();
+        auto pageRankSharedState = sharedState->ptrCast<PageRankSharedState>();
         auto pageRankLocalState = localState->ptrCast<PageRankLocalState>();
-        // Initialize state.
-        std::vector<double> ranks;
-        ranks.resize(graph->getNumNodes());
-        for (auto offset = 0u; offset < graph->getNumNodes(); ++offset) {
-            ranks[offset] = (double)1 / graph->getNumNodes();
-        }
-        auto dampingValue = (1 - extraData->dampingFactor) / graph->getNumNodes();
-        // Compute page rank.
-        for (auto i = 0u; i < extraData->maxIteration; ++i) {
+        auto phase = PageRankPhase::INIT;
+        offset_t startOffset = 0, endOffset = 0;
+        while (pageRankSharedState->getMorsel(phase, startOffset, endOffset)) {
             auto change = 0.0;
-            for (auto offset = 0u; offset < graph->getNumNodes(); ++offset) {
-                auto rank = 0.0;
-                auto nbrs = graph->getNbrs(offset);
-                for (auto& nbr : nbrs) {
-                    auto numNbrOfNbr = graph->getNbrs(nbr.offset).size();
-                    if (numNbrOfNbr == 0) {
-                        numNbrOfNbr = graph->getNumNodes();
-                    }
-                    rank += extraData->dampingFactor * (ranks[nbr.offset] / numNbrOfNbr);
+            try {
+                switch (phase) {
+                case PageRankPhase::INIT: {
+                    pageRankSharedState->init();
+                } break;
+                case PageRankPhase::PULL: {
+                    change = pageRankSharedState->pull(startOffset, endOffset);
+                } break;
+                case PageRankPhase::PUSH: {
+                    pageRankSharedState->push(startOffset, endOffset);
+                } break;
+                case PageRankPhase::APPLY: {
+                    change = pageRankSharedState->apply(startOffset, endOffset);
+                } break;
+                case PageRankPhase::MATERIALIZE: {
+                    pageRankLocalState->materialize(graph, pageRankSharedState->getRanks(),
+                        startOffset, endOffset);
+                } break;
+                default:
+                    KU_UNREACHABLE;
                 }
-                rank += dampingValue;
-                double diff = ranks[offset] - rank;
-                change += diff < 0 ? -diff : diff;
-                ranks[offset] = rank;
-            }
-            if (change < extraData->delta) {
-                break;
+            } catch (std::exception& e) {
+                pageRankSharedState->terminate();
+                throw;
             }
+            pageRankSharedState->finishMorsel(change);
         }
-        // Materialize result.
-        pageRankLocalState->materialize(graph, ranks, *table);
+        std::unique_lock lck{pageRankSharedState->mtx};
+        table->merge(*pageRankLocalState->getLocalTable());
     }
 
     std::unique_ptr<GDSAlgorithm> copy() const override {
         return std::make_unique<PageRank>(*this);
     }
+
+private:
+    bool hasVariantParameter;
 };
 
 function_set PageRankFunction::getFunctionSet() {
     function_set result;
-    auto function = std::make_unique<GDSFunction>(name, std::make_unique<PageRank>());
-    result.push_back(std::move(function));
+    result.push_back(std::make_unique<GDSFunction>(name, std::make_unique<PageRank>()));
+    result.push_back(std::make_unique<GDSFunction>(name,
+        std::make_unique<PageRank>(true /* hasVariantParameter */)));
     return result;
 }
 
@@ -138,9 +138,8 @@ public:
                         continue;
                     }
                     sourceState.markVisited(currentNodeID, currentLevel);
-                    auto nbrs = graph->getNbrs(currentNodeID.offset);
-                    for (auto nbr : nbrs) {
-                        sourceState.nextFrontier.addNode(nbr, 1);
+                    for (auto nbrOffset : graph->getNbrOffsets(currentNodeID.offset)) {
+                        sourceState.nextFrontier.addNode({nbrOffset, graph->getNodeTableID()}, 1);
                     }
                 }
                 sourceState.initNextFrontier();
@@ -131,9 +131,9 @@ public:
                 for (auto currentNodeID : sourceState.currentFrontier.getNodeIDs()) {
                     auto currentMultiplicity =
                         sourceState.currentFrontier.getMultiplicity(currentNodeID);
-                    auto nbrs = graph->getNbrs(currentNodeID.offset);
-                    for (auto nbr : nbrs) {
-                        sourceState.nextFrontier.addNode(nbr, currentMultiplicity);
+                    for (auto nbrOffset : graph->getNbrOffsets(currentNodeID.offset)) {
+                        sourceState.nextFrontier.addNode({nbrOffset, graph->getNodeTableID()},
+                            currentMultiplicity);
                     }
                 }
                 if (currentLevel >= extraData->lowerBound) {
@@ -86,12 +86,12 @@ private:
     void findConnectedComponent(common::offset_t offset, int64_t groupID) {
         visitedArray[offset] = true;
         groupArray[offset] = groupID;
-        auto nbrs = graph->getNbrs(offset);
-        for (auto nbr : nbrs) {
-            if (visitedArray[nbr.offset]) {
+        // The span stays valid across the recursive calls because the graph is in memory.
+        for (auto nbrOffset : graph->getNbrOffsets(offset)) {
+            if (visitedArray[nbrOffset]) {
                 continue;
             }
-            findConnectedComponent(nbr.offset, groupID);
+            findConnectedComponent(nbrOffset, groupID);
         }
     }
 
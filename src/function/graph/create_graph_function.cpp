@@ -2,7 +2,10 @@
 #include "binder/expression/graph_expression.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/expression_binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/binder.h"
+#include "common/string_format.h"
 #include "function/graph/graph_functions.h"
 #include "function/rewrite_function.h"
 #include "main/client_context.h"
@@ -13,20 +16,49 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace function {
 
+static void validateWeightProperty(main::ClientContext* context, const std::string& relName,
+    const std::string& propertyName) {
+    auto catalog = context->getCatalog();
+    auto tx = context->getTx();
+    if (!catalog->containsTable(tx, relName)) {
+        throw BinderException(stringFormat("Table {} does not exist.", relName));
+    }
+    auto entry = catalog->getTableCatalogEntry(tx, catalog->getTableID(tx, relName));
+    if (!entry->containProperty(propertyName)) {
+        throw BinderException(
+            stringFormat("Cannot find property {} in table {}.", propertyName, relName));
+    }
+    auto dataType = entry->getProperty(entry->getPropertyID(propertyName))->getDataType();
+    auto typeID = dataType->getLogicalTypeID();
+    if (!LogicalTypeUtils::isNumerical(typeID) || typeID == LogicalTypeID::INT128 ||
+        typeID == LogicalTypeID::DECIMAL) {
+        throw BinderException(stringFormat("Cannot use property {} of type {} as graph weight.",
+            propertyName, dataType->toString()));
+    }
+}
+
 static std::shared_ptr<Expression> rewriteFunc(const expression_vector& params,
     ExpressionBinder* expressionBinder) {
     auto uniqueName = expressionBinder->getUniqueName(CreateGraphFunction::name);
-    if (params.size() != 2) {
-        throw BinderException("Graph function requires 2 parameters.");
+    if (params.size() != 2 && params.size() != 3) {
+        throw BinderException("Graph function requires 2 or 3 parameters.");
+    }
+    for (auto& param : params) {
+        ExpressionUtil::validateExpressionType(*param, ExpressionType::LITERAL);
+        ExpressionUtil::validateDataType(*param, *LogicalType::STRING());
     }
-    ExpressionUtil::validateExpressionType(*params[0], ExpressionType::LITERAL);
-    ExpressionUtil::validateExpressionType(*params[1], ExpressionType::LITERAL);
-    ExpressionUtil::validateDataType(*params[0], *LogicalType::STRING());
-    ExpressionUtil::validateDataType(*params[1], *LogicalType::STRING());
     auto nodeName =
         params[0]->constPtrCast<LiteralExpression>()->getValue().getValue<std::string>();
     auto relName = params[1]->constPtrCast<LiteralExpression>()->getValue().getValue<std::string>();
-    return std::make_shared<GraphExpression>(std::move(uniqueName), nodeName, relName);
+    std::string weightPropertyName;
+    if (params.size() == 3) {
+        weightPropertyName =
+            params[2]->constPtrCast<LiteralExpression>()->getValue().getValue<std::string>();
+        validateWeightProperty(expressionBinder->getClientContext(), relName,
+            weightPropertyName);
+    }
+    return std::make_shared<GraphExpression>(std::move(uniqueName), nodeName, relName,
+        weightPropertyName);
 }
 
 function_set CreateGraphFunction::getFunctionSet() {
@@ -0,0 +1,89 @@
+#include "function/table/call_functions.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+struct BufferManagerInfoBindData final : public CallTableFuncBindData {
+    EvictionPolicy evictionPolicy;
+    uint64_t numPageAccesses;
+    uint64_t numPageReads;
+    uint64_t numAsyncPageReads;
+    uint64_t numEvictions;
+
+    BufferManagerInfoBindData(EvictionPolicy evictionPolicy, uint64_t numPageAccesses,
+        uint64_t numPageReads, uint64_t numAsyncPageReads, uint64_t numEvictions,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          evictionPolicy{evictionPolicy}, numPageAccesses{numPageAccesses},
+          numPageReads{numPageReads}, numAsyncPageReads{numAsyncPageReads},
+          numEvictions{numEvictions} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<BufferManagerInfoBindData>(evictionPolicy, numPageAccesses,
+            numPageReads, numAsyncPageReads, numEvictions, columnTypes, columnNames, maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto bindData = input.bindData->constPtrCast<BufferManagerInfoBindData>();
+    auto pos = dataChunk.state->getSelVector()[0];
+    dataChunk.getValueVector(0)->setValue(pos,
+        std::string(bindData->evictionPolicy == EvictionPolicy::SCAN_RESISTANT ? "SCAN_RESISTANT" :
+                                                                                 "FIFO"));
+    dataChunk.getValueVector(1)->setValue<int64_t>(pos, bindData->numPageAccesses);
+    dataChunk.getValueVector(2)->setValue<int64_t>(pos, bindData->numPageReads);
+    dataChunk.getValueVector(3)->setValue<int64_t>(pos, bindData->numAsyncPageReads);
+    dataChunk.getValueVector(4)->setValue<int64_t>(pos, bindData->numEvictions);
+    auto hitRateVector = dataChunk.getValueVector(5);
+    if (bindData->numPageAccesses == 0) {
+        hitRateVector->setNull(pos, true);
+    } else {
+        // Pages read ahead but never accessed count as reads, so the rate is clamped at 0.
+        auto numMisses = std::min(bindData->numPageReads, bindData->numPageAccesses);
+        hitRateVector->setNull(pos, false);
+        hitRateVector->setValue<double>(pos,
+            1 - (double)numMisses / (double)bindData->numPageAccesses);
+    }
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> returnColumnNames;
+    std::vector<LogicalType> returnTypes;
+    returnColumnNames.emplace_back("eviction_policy");
+    returnTypes.emplace_back(*LogicalType::STRING());
+    for (auto columnName :
+        {"num_page_accesses", "num_page_reads", "num_async_page_reads", "num_evictions"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::INT64());
+    }
+    returnColumnNames.emplace_back("hit_rate");
+    returnTypes.emplace_back(*LogicalType::DOUBLE());
+    auto bm = context->getMemoryManager()->getBufferManager();
+    return std::make_unique<BufferManagerInfoBindData>(bm->getEvictionPolicy(),
+        bm->getNumPageAccesses(), bm->getNumPageReads(), bm->getNumAsyncPageReads(),
+        bm->getNumEvictions(),
+        std::move(returnTypes), std::move(returnColumnNames), 1 /* one row result */);
+}
+
+function_set BufferManagerInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -0,0 +1,76 @@
+#include "function/table/call_functions.h"
+#include "transaction/transaction_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace function {
+
+struct CheckpointInfoBindData final : public CallTableFuncBindData {
+    transaction::CheckpointStats stats;
+
+    CheckpointInfoBindData(transaction::CheckpointStats stats,
+        std::vector<LogicalType> returnTypes, std::vector<std::string> returnColumnNames,
+        offset_t maxOffset)
+        : CallTableFuncBindData{std::move(returnTypes), std::move(returnColumnNames), maxOffset},
+          stats{stats} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CheckpointInfoBindData>(stats, columnTypes, columnNames,
+            maxOffset);
+    }
+};
+
+static common::offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
+    auto& dataChunk = output.dataChunk;
+    auto sharedState = input.sharedState->ptrCast<CallFuncSharedState>();
+    if (!sharedState->getMorsel().hasMoreToOutput()) {
+        return 0;
+    }
+    auto& stats = input.bindData->constPtrCast<CheckpointInfoBindData>()->stats;
+    auto pos = dataChunk.state->getSelVector()[0];
+    auto numCheckpoints = stats.numCheckpoints;
+    dataChunk.getValueVector(0)->setValue<int64_t>(pos, numCheckpoints);
+    dataChunk.getValueVector(1)->setValue<int64_t>(pos, stats.numDeferredCheckpoints);
+    dataChunk.getValueVector(2)->setValue<int64_t>(pos, stats.lastDuration);
+    dataChunk.getValueVector(3)->setValue<int64_t>(pos,
+        numCheckpoints == 0 ? 0 : stats.totalDuration / numCheckpoints);
+    dataChunk.getValueVector(4)->setValue<int64_t>(pos, stats.maxDuration);
+    dataChunk.getValueVector(5)->setValue<int64_t>(pos, stats.totalDuration);
+    dataChunk.getValueVector(6)->setValue<int64_t>(pos, stats.totalWaitDuration);
+    auto lastCheckpointVector = dataChunk.getValueVector(7);
+    if (numCheckpoints == 0) {
+        lastCheckpointVector->setNull(pos, true);
+    } else {
+        lastCheckpointVector->setNull(pos, false);
+        lastCheckpointVector->setValue(pos, timestamp_t(stats.lastCheckpointTS));
+    }
+    return 1;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* context, TableFuncBindInput*) {
+    std::vector<std::string> returnColumnNames;
+    std::vector<LogicalType> returnTypes;
+    // Durations are in microseconds.
+    for (auto columnName : {"num_checkpoints", "num_deferred_checkpoints", "last_duration", "avg_duration", "max_duration",
+             "total_duration", "total_wait_duration"}) {
+        returnColumnNames.emplace_back(columnName);
+        returnTypes.emplace_back(*LogicalType::INT64());
+    }
+    returnColumnNames.emplace_back("last_checkpoint");
+    returnTypes.emplace_back(*LogicalType::TIMESTAMP());
+    return std::make_unique<CheckpointInfoBindData>(
+        context->getTransactionManagerUnsafe()->getCheckpointStats(), std::move(returnTypes),
+        std::move(returnColumnNames), 1 /* one row result */);
+}
+
+function_set CheckpointInfoFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(std::make_unique<TableFunction>(name, tableFunc, bindFunc,
+        initSharedState, initEmptyLocalState, std::vector<LogicalTypeID>{}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "function/string/vector_string_functions.h"
 
+#include "binder/expression/literal_expression.h"
+
 #include "function/string/functions/array_extract_function.h"
 #include "function/string/functions/contains_function.h"
 #include "function/string/functions/ends_with_function.h"
@@ -231,26 +233,51 @@ function_set SubStrFunction::getFunctionSet() {
     return functionSet;
 }
 
+// Compiles the pattern (i.e. the second argument) at bind time if it is a literal.
+static std::unique_ptr<FunctionBindData> bindRegexpFunc(const binder::expression_vector& arguments,
+    std::unique_ptr<LogicalType> resultType) {
+    std::unique_ptr<RE2> pattern;
+    auto& patternExpr = *arguments[1];
+    if (patternExpr.expressionType == ExpressionType::LITERAL &&
+        patternExpr.getDataType().getLogicalTypeID() == LogicalTypeID::STRING) {
+        auto value = patternExpr.constCast<binder::LiteralExpression>().getValue();
+        if (!value.isNull()) {
+            pattern = BaseRegexpOperation::compilePattern(value.getValue<std::string>());
+        }
+    }
+    return std::make_unique<RegexpBindData>(std::move(resultType), std::move(pattern));
+}
+
 function_set RegexpFullMatchFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::BOOL,
-        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpFullMatch>,
-        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpFullMatch>));
+        ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t, RegexpFullMatch>,
+        bindFunc));
     return functionSet;
 }
 
+std::unique_ptr<FunctionBindData> RegexpFullMatchFunction::bindFunc(
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexpFunc(arguments, LogicalType::BOOL());
+}
+
 function_set RegexpMatchesFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::BOOL,
-        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
-        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpMatches>));
+        ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
+        bindFunc));
     return functionSet;
 }
 
+std::unique_ptr<FunctionBindData> RegexpMatchesFunction::bindFunc(
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexpFunc(arguments, LogicalType::BOOL());
+}
+
 function_set RegexpReplaceFunction::getFunctionSet() {
     function_set functionSet;
     // Todo: Implement a function with modifiers
@@ -259,48 +286,61 @@ function_set RegexpReplaceFunction::getFunctionSet() {
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
             LogicalTypeID::STRING},
         LogicalTypeID::STRING,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, ku_string_t,
-            ku_string_t, RegexpReplace>));
+        ScalarFunction::TernaryStringExecWithBindData<ku_string_t, ku_string_t, ku_string_t,
+            ku_string_t, RegexpReplace>,
+        bindFunc));
     return functionSet;
 }
 
+std::unique_ptr<FunctionBindData> RegexpReplaceFunction::bindFunc(
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexpFunc(arguments, LogicalType::STRING());
+}
+
 function_set RegexpExtractFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::STRING,
-        ScalarFunction::BinaryStringExecFunction<ku_string_t, ku_string_t, ku_string_t,
-            RegexpExtract>));
+        ScalarFunction::BinaryStringExecWithBindData<ku_string_t, ku_string_t, ku_string_t,
+            RegexpExtract>,
+        bindFunc));
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
             LogicalTypeID::INT64},
         LogicalTypeID::STRING,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, int64_t, ku_string_t,
-            RegexpExtract>));
+        ScalarFunction::TernaryStringExecWithBindData<ku_string_t, ku_string_t, int64_t,
+            ku_string_t, RegexpExtract>,
+        bindFunc));
     return functionSet;
 }
 
+std::unique_ptr<FunctionBindData> RegexpExtractFunction::bindFunc(
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexpFunc(arguments, LogicalType::STRING());
+}
+
 function_set RegexpExtractAllFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::LIST,
-        ScalarFunction::BinaryStringExecFunction<ku_string_t, ku_string_t, list_entry_t,
+        ScalarFunction::BinaryStringExecWithBindData<ku_string_t, ku_string_t, list_entry_t,
             RegexpExtractAll>,
         nullptr, bindFunc));
     functionSet.emplace_back(make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING,
             LogicalTypeID::INT64},
         LogicalTypeID::LIST,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, int64_t, list_entry_t,
-            RegexpExtractAll>,
+        ScalarFunction::TernaryStringExecWithBindData<ku_string_t, ku_string_t, int64_t,
+            list_entry_t, RegexpExtractAll>,
         nullptr, bindFunc));
     return functionSet;
 }
 
 std::unique_ptr<FunctionBindData> RegexpExtractAllFunction::bindFunc(
-    const binder::expression_vector& /*arguments*/, Function* /*definition*/) {
-    return std::make_unique<FunctionBindData>(LogicalType::LIST(LogicalType::STRING()));
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexpFunc(arguments, LogicalType::LIST(LogicalType::STRING()));
 }
 
 } // namespace function
@@ -0,0 +1,158 @@
+#include "graph/in_mem_csr_graph.h"
+
+#include <cstring>
+
+#include "common/exception/runtime.h"
+#include "common/type_utils.h"
+#include "graph/on_disk_graph.h"
+#include "main/client_context.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::storage;
+using namespace kuzu::main;
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace graph {
+
+InMemoryCSRGraph::InMemoryCSRGraph(ClientContext* context, const std::string& nodeName,
+    const std::string& relName, const std::string& weightPropertyName)
+    : context{context}, weightColumnID{INVALID_COLUMN_ID}, numEdges{0}, nextNodeGroupIdx{0},
+      numScannedNodeGroups{0}, scanFailed{false} {
+    auto catalog = context->getCatalog();
+    auto storage = context->getStorageManager();
+    auto tx = context->getTx();
+    auto nodeTableID = catalog->getTableID(tx, nodeName);
+    nodeTable = storage->getTable(nodeTableID)->ptrCast<NodeTable>();
+    auto relTableID = catalog->getTableID(tx, relName);
+    relTable = storage->getTable(relTableID)->ptrCast<RelTable>();
+    if (!weightPropertyName.empty()) {
+        auto relEntry = catalog->getTableCatalogEntry(tx, relTableID);
+        auto propertyID = relEntry->getPropertyID(weightPropertyName);
+        weightColumnID = relEntry->getColumnID(propertyID);
+        weightType = relEntry->getProperty(propertyID)->getDataType()->copy();
+    }
+    numNodes = nodeTable->getNumTuples(tx);
+    auto numNodeGroups = numNodes == 0 ? 0 : StorageUtils::getNodeGroupIdx(numNodes - 1) + 1;
+    segments.resize(numNodeGroups);
+}
+
+std::span<const offset_t> InMemoryCSRGraph::getNbrOffsets(offset_t offset) {
+    KU_ASSERT(offset < numNodes);
+    auto [segment, offsetInSegment] = getSegment(offset);
+    auto csrOffsets = segment->getCSROffsets();
+    auto numNbrs = csrOffsets[offsetInSegment + 1] - csrOffsets[offsetInSegment];
+    if (numNbrs == 0) {
+        return {};
+    }
+    return {segment->getNbrOffsets() + csrOffsets[offsetInSegment], numNbrs};
+}
+
+std::span<const double> InMemoryCSRGraph::getNbrWeights(offset_t offset) {
+    KU_ASSERT(offset < numNodes);
+    if (!hasWeights()) {
+        return {};
+    }
+    auto [segment, offsetInSegment] = getSegment(offset);
+    auto csrOffsets = segment->getCSROffsets();
+    auto numNbrs = csrOffsets[offsetInSegment + 1] - csrOffsets[offsetInSegment];
+    if (numNbrs == 0) {
+        return {};
+    }
+    return {segment->getWeights() + csrOffsets[offsetInSegment], numNbrs};
+}
+
+void InMemoryCSRGraph::scan() {
+    while (true) {
+        auto nodeGroupIdx = nextNodeGroupIdx.fetch_add(1);
+        if (nodeGroupIdx >= segments.size()) {
+            break;
+        }
+        try {
+            scanNodeGroup(nodeGroupIdx);
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            scanFailed = true;
+            cv.notify_all();
+            throw;
+        }
+        std::unique_lock lck{mtx};
+        numScannedNodeGroups++;
+        if (numScannedNodeGroups == segments.size()) {
+            cv.notify_all();
+        }
+    }
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return scanFailed || numScannedNodeGroups == segments.size(); });
+    if (scanFailed) {
+        throw RuntimeException("Failed to scan graph into memory.");
+    }
+}
+
+void InMemoryCSRGraph::scanNodeGroup(node_group_idx_t nodeGroupIdx) {
+    auto mm = context->getMemoryManager();
+    auto tx = context->getTx();
+    auto nbrScanState = hasWeights() ?
+                            std::make_unique<NbrScanState>(mm, weightColumnID, *weightType) :
+                            std::make_unique<NbrScanState>(mm);
+    auto readState = nbrScanState->fwdReadState.get();
+    auto dstState = nbrScanState->dstNodeIDVectorState.get();
+    auto dstVector = nbrScanState->dstNodeIDVector.get();
+    auto weightVector = nbrScanState->propertyVector.get();
+    auto startOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    auto numNodesInGroup = std::min(numNodes - startOffset, StorageConstants::NODE_GROUP_SIZE);
+    auto& segment = segments[nodeGroupIdx];
+    segment.csrOffsets = mm->allocateBuffer(false /* initializeToZero */,
+        (numNodesInGroup + 1) * sizeof(offset_t));
+    auto csrOffsets = reinterpret_cast<offset_t*>(segment.csrOffsets->buffer);
+    std::vector<offset_t> nbrOffsets;
+    std::vector<double> weights;
+    csrOffsets[0] = 0;
+    for (auto i = 0u; i < numNodesInGroup; ++i) {
+        nbrScanState->srcNodeIDVector->setValue<nodeID_t>(0,
+            {startOffset + i, nodeTable->getTableID()});
+        relTable->initializeScanState(tx, *readState);
+        while (readState->hasMoreToRead(tx)) {
+            relTable->scan(tx, *readState);
+            KU_ASSERT(dstState->getSelVector().isUnfiltered());
+            auto numNbrs = dstState->getSelVector().getSelSize();
+            for (auto j = 0u; j < numNbrs; ++j) {
+                nbrOffsets.push_back(dstVector->getValue<nodeID_t>(j).offset);
+            }
+            if (weightVector == nullptr) {
+                continue;
+            }
+            TypeUtils::visit(
+                weightType->getPhysicalType(),
+                [&]<typename T>(T)
+                    requires(std::integral<T> || std::floating_point<T>)
+                {
+                    for (auto j = 0u; j < numNbrs; ++j) {
+                        // Null weights are read as 0.
+                        weights.push_back(weightVector->isNull(j) ?
+                                              0 :
+                                              static_cast<double>(weightVector->getValue<T>(j)));
+                    }
+                },
+                [](auto) { KU_UNREACHABLE; });
+        }
+        csrOffsets[i + 1] = nbrOffsets.size();
+    }
+    if (nbrOffsets.empty()) {
+        return;
+    }
+    segment.nbrOffsets = mm->allocateBuffer(false /* initializeToZero */,
+        nbrOffsets.size() * sizeof(offset_t));
+    memcpy(segment.nbrOffsets->buffer, nbrOffsets.data(), nbrOffsets.size() * sizeof(offset_t));
+    if (weightVector != nullptr) {
+        segment.weights =
+            mm->allocateBuffer(false /* initializeToZero */, weights.size() * sizeof(double));
+        memcpy(segment.weights->buffer, weights.data(), weights.size() * sizeof(double));
+    }
+    numEdges += nbrOffsets.size();
+}
+
+} // namespace graph
+} // namespace kuzu
@@ -22,6 +22,18 @@ NbrScanState::NbrScanState(MemoryManager* mm) {
     fwdReadState->outputVectors.push_back(dstNodeIDVector.get());
 }
 
+NbrScanState::NbrScanState(MemoryManager* mm, column_id_t propertyColumnID,
+    const LogicalType& propertyType)
+    : NbrScanState{mm} {
+    propertyVector = std::make_unique<ValueVector>(propertyType, mm);
+    propertyVector->state = dstNodeIDVectorState;
+    columnIDs.push_back(propertyColumnID);
+    fwdReadState = std::make_unique<RelTableScanState>(columnIDs, direction);
+    fwdReadState->nodeIDVector = srcNodeIDVector.get();
+    fwdReadState->outputVectors.push_back(dstNodeIDVector.get());
+    fwdReadState->outputVectors.push_back(propertyVector.get());
+}
+
 OnDiskGraph::OnDiskGraph(ClientContext* context, const std::string& nodeName,
     const std::string& relName)
     : context{context} {
@@ -43,23 +55,27 @@ offset_t OnDiskGraph::getNumEdges() {
     return relTable->getNumTuples(context->getTx());
 }
 
-std::vector<nodeID_t> OnDiskGraph::getNbrs(offset_t offset) {
+template<typename FUNC>
+void OnDiskGraph::scanNbrs(offset_t offset, FUNC func) {
     nbrScanState->srcNodeIDVector->setValue<nodeID_t>(0, {offset, nodeTable->getTableID()});
     auto tx = context->getTx();
     auto readState = nbrScanState->fwdReadState.get();
     auto dstState = nbrScanState->dstNodeIDVectorState.get();
     auto dstVector = nbrScanState->dstNodeIDVector.get();
-    std::vector<nodeID_t> nbrs;
     relTable->initializeScanState(tx, *readState);
     while (nbrScanState->fwdReadState->hasMoreToRead(tx)) {
         relTable->scan(tx, *readState);
         KU_ASSERT(dstState->getSelVector().isUnfiltered());
         for (auto i = 0u; i < dstState->getSelVector().getSelSize(); ++i) {
-            auto nodeID = dstVector->getValue<nodeID_t>(i);
-            nbrs.push_back(nodeID);
+            func(dstVector->getValue<nodeID_t>(i));
         }
     }
-    return nbrs;
+}
+
+std::span<const offset_t> OnDiskGraph::getNbrOffsets(offset_t offset) {
+    nbrOffsets.clear();
+    scanNbrs(offset, [&](nodeID_t nodeID) { nbrOffsets.push_back(nodeID.offset); });
+    return nbrOffsets;
 }
 
 } // namespace graph
@@ -10,12 +10,16 @@ class GraphExpression : public Expression {
     static constexpr common::ExpressionType exprType = common::ExpressionType::GRAPH;
 
 public:
-    GraphExpression(std::string uniqueName, std::string nodeName, std::string relName)
+    GraphExpression(std::string uniqueName, std::string nodeName, std::string relName,
+        std::string weightPropertyName = "")
         : Expression{exprType, *common::LogicalType::ANY(), std::move(uniqueName)},
-          nodeName{std::move(nodeName)}, relName{std::move(relName)} {}
+          nodeName{std::move(nodeName)}, relName{std::move(relName)},
+          weightPropertyName{std::move(weightPropertyName)} {}
 
     std::string getNodeName() const { return nodeName; }
     std::string getRelName() const { return relName; }
+    // Empty if the graph is unweighted.
+    std::string getWeightPropertyName() const { return weightPropertyName; }
 
 protected:
     std::string toStringInternal() const override { return alias.empty() ? uniqueName : alias; }
@@ -23,6 +27,7 @@ protected:
 private:
     std::string nodeName;
     std::string relName;
+    std::string weightPropertyName;
 };
 
 } // namespace binder
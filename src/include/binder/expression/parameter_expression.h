@@ -10,13 +10,18 @@ class ParameterExpression : public Expression {
     static constexpr common::ExpressionType expressionType = common::ExpressionType::PARAMETER;
 
 public:
-    explicit ParameterExpression(const std::string& parameterName, common::Value value)
-        : Expression{expressionType, *value.getDataType(), createUniqueName(parameterName)},
-          parameterName(parameterName), value{std::move(value)} {}
+    explicit ParameterExpression(const std::string& parameterName,
+        std::shared_ptr<common::Value> source)
+        : Expression{expressionType, *source->getDataType(), createUniqueName(parameterName)},
+          parameterName(parameterName), value{*source}, source{std::move(source)} {}
 
     void cast(const common::LogicalType& type) override;
 
-    common::Value getValue() const { return value; }
+    // Returns the latest value bound to the parameter. A prepared statement updates the source
+    // value in place on each execution so that a cached plan picks up new parameter values without
+    // rebinding. If the source type no longer matches the bound type (e.g. the parameter was cast
+    // from ANY during binding), the bound value is returned instead.
+    common::Value getValue() const;
 
 private:
     std::string toStringInternal() const final { return "$" + parameterName; }
@@ -25,6 +30,7 @@ private:
 private:
     std::string parameterName;
     common::Value value;
+    std::shared_ptr<common::Value> source;
 };
 
 } // namespace binder
@@ -112,6 +112,8 @@ public:
 
     std::string getUniqueName(const std::string& name) const;
 
+    main::ClientContext* getClientContext() const { return context; }
+
 private:
     Binder* binder;
     main::ClientContext* context;
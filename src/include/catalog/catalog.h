@@ -102,6 +102,10 @@ public:
         const std::string& name) const;
     std::vector<std::string> getMacroNames(transaction::Transaction* tx) const;
 
+    // Monotonically increasing version of the catalog. Any change to table, sequence or function
+    // entries (including commit and rollback of such changes) results in a different version.
+    uint64_t getVersion() const;
+
     void prepareCheckpoint(const std::string& databasePath, storage::WAL* wal,
         common::VirtualFileSystem* fs);
 
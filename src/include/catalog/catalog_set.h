@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "catalog_entry/catalog_entry.h"
 #include "common/case_insensitive_map.h"
 
@@ -31,6 +33,9 @@ public:
     CatalogEntrySet getEntries(transaction::Transaction* transaction);
 
     uint64_t assignNextOID() { return nextOID++; }
+    // Version is bumped whenever an entry is created, dropped, altered, committed or rolled back.
+    // It is used by prepared statements to detect that a cached plan might be stale.
+    uint64_t getVersion() const { return version.load(); }
 
     //===--------------------------------------------------------------------===//
     // serialization & deserialization
@@ -52,8 +57,11 @@ private:
     CatalogEntry* getCommittedEntry(CatalogEntry* entry) const;
     bool checkWWConflict(transaction::Transaction* transaction, CatalogEntry* entry) const;
 
+    void incrementVersion() { version++; }
+
 private:
     uint64_t nextOID = 0;
+    std::atomic<uint64_t> version = 0;
     common::case_insensitive_map_t<std::unique_ptr<CatalogEntry>> entries;
 };
 
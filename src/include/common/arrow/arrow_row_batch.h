@@ -51,6 +51,15 @@ public:
     ArrowArray append(main::QueryResult& queryResult, std::int64_t chunkSize);
 
 private:
+    // Copies the next chunkSize tuples column by column straight out of the result
+    // FactorizedTable. Only used if the table has no unflat columns and all column types support
+    // it; otherwise tuples are appended row by row through Values.
+    ArrowArray appendColumns(main::QueryResult& queryResult, std::int64_t chunkSize);
+    // Copies up to maxNumTuples tuples from the position of the iterator, and moves the iterator
+    // past them. Returns the number of tuples copied.
+    uint64_t copyColumns(const processor::FactorizedTable& table,
+        processor::FlatTupleIterator& iterator, uint64_t maxNumTuples, uint64_t maxNumThreads);
+
     static std::unique_ptr<ArrowVector> createVector(const LogicalType& type,
         std::int64_t capacity);
     static void appendValue(ArrowVector* vector, const LogicalType& type, Value* value);
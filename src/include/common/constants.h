@@ -72,6 +72,15 @@ struct BufferPoolConstants {
     // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
     // `EvictionQueue::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
+    // Under the SCAN_RESISTANT eviction policy, candidates are evicted from the probation queue as
+    // long as it holds at least this ratio of all eviction candidates. See `EvictionQueue`.
+    static constexpr double SCAN_RESISTANT_MIN_PROBATION_RATIO = 0.25;
+    // Number of pages a sequential column scan reads ahead with a single read when it reaches a
+    // page that is not cached. Can be changed through `SystemConfig::readAheadNumPages`.
+    static constexpr uint64_t DEFAULT_READ_AHEAD_NUM_PAGES = 32;
+    // Number of background threads reading pages ahead of scans when
+    // `SystemConfig::asyncReadAhead` is enabled.
+    static constexpr uint64_t NUM_ASYNC_READ_AHEAD_THREADS = 4;
 // The default max size for a VMRegion.
 #ifdef __32BIT__
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = (uint64_t)1 << 30; // (1GB)
@@ -44,6 +44,14 @@ public:
     // they will error.
     void resetBuffer();
 
+    uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->size;
+        }
+        return memoryUsage;
+    }
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return currentBlock == nullptr ||
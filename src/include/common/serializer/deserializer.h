@@ -23,6 +23,8 @@ public:
         reader->read((uint8_t*)&value, sizeof(T));
     }
 
+    void read(uint8_t* data, uint64_t size) { reader->read(data, size); }
+
     template<typename T>
     void deserializeOptionalValue(std::unique_ptr<T>& value) {
         bool isNull;
@@ -30,6 +30,11 @@ struct ScheduledTask {
  * Schedule one task T and wait for T to finish or error if there was an exception raised by
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
+ * The children of T (and their children) are dependencies of T. They are either scheduled one
+ * after another, or concurrently if the caller knows that sibling tasks do not depend on each
+ * other. In the latter case, a task is put into the queue as soon as all its children complete,
+ * so independent tasks share the worker threads, e.g. a thread that cannot register to a
+ * single-threaded task moves on to the next task in the queue.
  *
  * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
  * this does not guarantee that the tasks will be completed in FIFO order: a long running task
@@ -41,18 +46,25 @@ public:
     explicit TaskScheduler(uint64_t numThreads);
     ~TaskScheduler();
 
-    // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
-    // whether or not the given task or one of its dependencies errors, when this function
-    // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
+    // Schedules the dependencies of the given task and finally the task, and throws an exception
+    // if any of the tasks errors. If runChildrenConcurrently is false, the dependencies are
+    // scheduled one after another (so not concurrently). Otherwise, a task is scheduled once all
+    // its children complete, regardless of its siblings. Regardless of whether or not the given
+    // task or one of its dependencies errors, when this function returns, no task related to the
+    // given task will be in the task queue. Further no worker thread will be working on the given
+    // task.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
-        processor::ExecutionContext* context);
+        processor::ExecutionContext* context, bool runChildrenConcurrently = false);
 
 private:
+    void scheduleTaskTreeAndWaitOrError(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context);
+
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueueNoLock(const std::shared_ptr<Task>& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
+    void removeTaskNoLock(uint64_t scheduledTaskID);
 
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
     void runWorkerThread();
@@ -64,6 +76,8 @@ private:
     std::vector<std::thread> threads;
     std::mutex mtx;
     std::condition_variable cv;
+    // Notified whenever a worker thread finishes working on a task.
+    std::condition_variable taskFinishedCV;
     uint64_t nextScheduledTaskID;
 };
 
@@ -16,6 +16,17 @@ struct AvgFunction {
             memcpy(outputVector->getData() + pos * outputVector->getNumBytesPerValue(),
                 reinterpret_cast<uint8_t*>(&avg), outputVector->getNumBytesPerValue());
         }
+        // avg is only computed when the state is finalized.
+        void serialize(common::Serializer& serializer) const override {
+            AggregateState::serialize(serializer);
+            serializer.write(sum);
+            serializer.write(count);
+        }
+        void deserialize(common::Deserializer& deserializer) override {
+            AggregateState::deserialize(deserializer);
+            deserializer.deserializeValue(sum);
+            deserializer.deserializeValue(count);
+        }
 
         T sum;
         uint64_t count = 0;
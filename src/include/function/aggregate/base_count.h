@@ -13,6 +13,14 @@ struct BaseCountFunction {
             memcpy(outputVector->getData() + pos * outputVector->getNumBytesPerValue(),
                 reinterpret_cast<uint8_t*>(&count), outputVector->getNumBytesPerValue());
         }
+        void serialize(common::Serializer& serializer) const override {
+            AggregateState::serialize(serializer);
+            serializer.write(count);
+        }
+        void deserialize(common::Deserializer& deserializer) override {
+            AggregateState::deserialize(deserializer);
+            deserializer.deserializeValue(count);
+        }
 
         uint64_t count = 0;
     };
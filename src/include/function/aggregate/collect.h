@@ -26,6 +26,7 @@ struct CollectFunction {
             // manually deallocate the memory of CollectStates.
             factorizedTable.reset();
         }
+        bool hasExternalMemory() const override { return true; }
 
         std::unique_ptr<processor::FactorizedTable> factorizedTable;
     };
@@ -14,6 +14,17 @@ struct MinMaxFunction {
             outputVector->setValue(pos, val);
             overflowBuffer.reset();
         }
+        bool hasExternalMemory() const override {
+            return std::is_same_v<T, common::ku_string_t>;
+        }
+        void serialize(common::Serializer& serializer) const override {
+            AggregateState::serialize(serializer);
+            serializer.write(val);
+        }
+        void deserialize(common::Deserializer& deserializer) override {
+            AggregateState::deserialize(deserializer);
+            deserializer.deserializeValue(val);
+        }
         inline void setVal(T& val_, storage::MemoryManager* /*memoryManager*/) { val = val_; }
 
         std::unique_ptr<common::InMemOverflowBuffer> overflowBuffer;
@@ -15,6 +15,14 @@ struct SumFunction {
             memcpy(outputVector->getData() + pos * outputVector->getNumBytesPerValue(),
                 reinterpret_cast<uint8_t*>(&sum), outputVector->getNumBytesPerValue());
         }
+        void serialize(common::Serializer& serializer) const override {
+            AggregateState::serialize(serializer);
+            serializer.write(sum);
+        }
+        void deserialize(common::Deserializer& deserializer) override {
+            AggregateState::deserialize(deserializer);
+            deserializer.deserializeValue(sum);
+        }
 
         T sum;
     };
@@ -3,6 +3,8 @@
 #include <functional>
 #include <utility>
 
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
 #include "function/function.h"
 
@@ -12,6 +14,14 @@ namespace function {
 struct AggregateState {
     virtual uint32_t getStateSize() const = 0;
     virtual void moveResultToVector(common::ValueVector* outputVector, uint64_t pos) = 0;
+    // States referring to memory outside of themselves cannot be moved out of memory, e.g. when
+    // spilling them to disk.
+    virtual bool hasExternalMemory() const { return false; }
+    // Write and read back the fields of a state without external memory.
+    virtual void serialize(common::Serializer& serializer) const { serializer.write(isNull); }
+    virtual void deserialize(common::Deserializer& deserializer) {
+        deserializer.deserializeValue(isNull);
+    }
     virtual ~AggregateState() = default;
 
     bool isNull = true;
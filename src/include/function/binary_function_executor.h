@@ -56,6 +56,15 @@ struct BinaryComparisonFunctionWrapper {
     }
 };
 
+struct BinaryStringBindDataFunctionWrapper {
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename OP>
+    static inline void operation(LEFT_TYPE& left, RIGHT_TYPE& right, RESULT_TYPE& result,
+        common::ValueVector* /*leftValueVector*/, common::ValueVector* /*rightValueVector*/,
+        common::ValueVector* resultValueVector, uint64_t /*resultPos*/, void* dataPtr) {
+        OP::operation(left, right, result, *resultValueVector, dataPtr);
+    }
+};
+
 struct BinaryUDFFunctionWrapper {
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename OP>
     static inline void operation(LEFT_TYPE& left, RIGHT_TYPE& right, RESULT_TYPE& result,
@@ -275,6 +284,13 @@ struct BinaryFunctionExecutor {
             left, right, result, nullptr /* dataPtr */);
     }
 
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void executeStringWithBindData(common::ValueVector& left, common::ValueVector& right,
+        common::ValueVector& result, void* dataPtr) {
+        executeSwitch<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC,
+            BinaryStringBindDataFunctionWrapper>(left, right, result, dataPtr);
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
     static void executeUDF(common::ValueVector& left, common::ValueVector& right,
         common::ValueVector& result, void* dataPtr) {
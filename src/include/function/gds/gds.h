@@ -24,6 +24,18 @@ struct GDSBindData {
     }
 };
 
+// State shared by all threads executing the same GDS call. It is created once per execution, so
+// parallel algorithms can use it to coordinate their work.
+class GDSSharedState {
+public:
+    virtual ~GDSSharedState() = default;
+
+    template<class TARGET>
+    TARGET* ptrCast() {
+        return common::ku_dynamic_cast<GDSSharedState*, TARGET*>(this);
+    }
+};
+
 class GDSLocalState {
 public:
     virtual ~GDSLocalState() = default;
@@ -51,10 +63,21 @@ public:
 
     virtual void bind(const binder::expression_vector&) { bindData = nullptr; }
 
+    // A parallel algorithm is executed by multiple threads, each with its own copy of the
+    // algorithm. Threads share the graph, result table and the state returned by
+    // createSharedState().
+    virtual bool isParallel() const { return false; }
+    virtual std::shared_ptr<GDSSharedState> createSharedState(graph::Graph*) const {
+        return nullptr;
+    }
+    // Edge weights of the graph are only projected into memory for algorithms reading them.
+    virtual bool readsWeights() const { return false; }
+
     void init(graph::Graph* graph_, processor::FactorizedTable* table_,
-        main::ClientContext* context) {
+        std::shared_ptr<GDSSharedState> sharedState_, main::ClientContext* context) {
         graph = graph_;
         table = table_;
+        sharedState = std::move(sharedState_);
         initLocalState(context);
     }
 
@@ -72,6 +95,7 @@ protected:
     std::unique_ptr<GDSBindData> bindData;
     graph::Graph* graph;
     processor::FactorizedTable* table;
+    std::shared_ptr<GDSSharedState> sharedState;
     std::unique_ptr<GDSLocalState> localState;
 };
 
@@ -97,6 +97,35 @@ struct ScalarFunction final : public BaseScalarFunction {
             *params[1], result);
     }
 
+    // The following functions pass the bind data of the function (e.g. state precomputed from
+    // literal arguments) to FUNC.
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void BinaryExecWithBindData(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* dataPtr) {
+        KU_ASSERT(params.size() == 2);
+        BinaryFunctionExecutor::executeUDF<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(*params[0],
+            *params[1], result, dataPtr);
+    }
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void BinaryStringExecWithBindData(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* dataPtr) {
+        KU_ASSERT(params.size() == 2);
+        BinaryFunctionExecutor::executeStringWithBindData<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE,
+            FUNC>(*params[0], *params[1], result, dataPtr);
+    }
+
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void TernaryStringExecWithBindData(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* dataPtr) {
+        KU_ASSERT(params.size() == 3);
+        TernaryFunctionExecutor::executeStringWithBindData<A_TYPE, B_TYPE, C_TYPE, RESULT_TYPE,
+            FUNC>(*params[0], *params[1], *params[2], result, dataPtr);
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
     static bool BinarySelectFunction(
         const std::vector<std::shared_ptr<common::ValueVector>>& params,
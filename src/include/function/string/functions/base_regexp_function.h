@@ -3,10 +3,22 @@
 #include <regex>
 
 #include "common/vector/value_vector.h"
+#include "function/function.h"
+#include "re2.h"
 
 namespace kuzu {
 namespace function {
 
+// If the pattern of a regexp function is a literal, it is compiled once when binding the function
+// instead of for every input tuple. RE2 is safe for concurrent use, so the compiled pattern is
+// shared by all threads evaluating the expression.
+struct RegexpBindData final : public FunctionBindData {
+    std::unique_ptr<RE2> pattern;
+
+    RegexpBindData(std::unique_ptr<common::LogicalType> resultType, std::unique_ptr<RE2> pattern)
+        : FunctionBindData{std::move(resultType)}, pattern{std::move(pattern)} {}
+};
+
 struct BaseRegexpOperation {
     static inline std::string parseCypherPatten(const std::string& pattern) {
         // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
@@ -15,7 +27,27 @@ struct BaseRegexpOperation {
         return std::regex_replace(pattern, std::regex(R"(\\\\)"), "\\");
     }
 
-    static inline void copyToKuzuString(const std::string& value, common::ku_string_t& kuString,
+    static inline std::unique_ptr<RE2> compilePattern(const std::string& pattern) {
+        return std::make_unique<RE2>(parseCypherPatten(pattern));
+    }
+
+    // Returns the pattern compiled at bind time if there is one. Otherwise, compiles the given
+    // pattern into localPattern.
+    static inline const RE2& getPattern(const common::ku_string_t& pattern, void* dataPtr,
+        std::unique_ptr<RE2>& localPattern) {
+        auto bindData = reinterpret_cast<RegexpBindData*>(dataPtr);
+        if (bindData != nullptr && bindData->pattern != nullptr) {
+            return *bindData->pattern;
+        }
+        localPattern = compilePattern(pattern.getAsString());
+        return *localPattern;
+    }
+
+    static inline regex::StringPiece toStringPiece(const common::ku_string_t& value) {
+        return regex::StringPiece(reinterpret_cast<const char*>(value.getData()), value.len);
+    }
+
+    static inline void copyToKuzuString(regex::StringPiece value, common::ku_string_t& kuString,
         common::ValueVector& valueVector) {
         common::StringVector::addString(&valueVector, kuString, value.data(), value.length());
     }
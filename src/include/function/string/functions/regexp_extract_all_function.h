@@ -10,9 +10,11 @@ namespace function {
 
 struct RegexpExtractAll : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        std::int64_t& group, common::list_entry_t& result, common::ValueVector& resultVector) {
-        std::vector<std::string> matches =
-            regexExtractAll(value.getAsString(), pattern.getAsString(), group);
+        std::int64_t& group, common::list_entry_t& result, common::ValueVector& resultVector,
+        void* dataPtr) {
+        std::unique_ptr<RE2> localPattern;
+        auto& regex = getPattern(pattern, dataPtr, localPattern);
+        auto matches = regexExtractAll(toStringPiece(value), regex, group);
         result = common::ListVector::addList(&resultVector, matches.size());
         auto resultValues = common::ListVector::getListValues(&resultVector, result);
         auto resultDataVector = common::ListVector::getDataVector(&resultVector);
@@ -27,25 +29,23 @@ struct RegexpExtractAll : BaseRegexpOperation {
     }
 
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        common::list_entry_t& result, common::ValueVector& resultVector) {
+        common::list_entry_t& result, common::ValueVector& resultVector, void* dataPtr) {
         int64_t defaultGroup = 0;
-        operation(value, pattern, defaultGroup, result, resultVector);
+        operation(value, pattern, defaultGroup, result, resultVector, dataPtr);
     }
 
-    static std::vector<std::string> regexExtractAll(const std::string& value,
-        const std::string& pattern, std::int64_t& group) {
-        RE2 regex(parseCypherPatten(pattern));
+    static std::vector<regex::StringPiece> regexExtractAll(regex::StringPiece input,
+        const RE2& regex, std::int64_t& group) {
         auto submatchCount = regex.NumberOfCapturingGroups() + 1;
         if (group >= submatchCount) {
             throw common::RuntimeException("Regex match group index is out of range");
         }
 
-        regex::StringPiece input(value);
         std::vector<regex::StringPiece> targetSubMatches;
         targetSubMatches.resize(submatchCount);
         uint64_t startPos = 0;
 
-        std::vector<std::string> matches;
+        std::vector<regex::StringPiece> matches;
         while (regex.Match(input, startPos, input.length(), RE2::UNANCHORED,
             targetSubMatches.data(), submatchCount)) {
             uint64_t consumed =
@@ -11,20 +11,21 @@ namespace function {
 
 struct RegexpExtract : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector) {
-        regexExtract(value.getAsString(), pattern.getAsString(), group, result, resultValueVector);
+        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector,
+        void* dataPtr) {
+        std::unique_ptr<RE2> localPattern;
+        regexExtract(toStringPiece(value), getPattern(pattern, dataPtr, localPattern), group,
+            result, resultValueVector);
     }
 
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        common::ku_string_t& result, common::ValueVector& resultValueVector) {
+        common::ku_string_t& result, common::ValueVector& resultValueVector, void* dataPtr) {
         int64_t defaultGroup = 0;
-        regexExtract(value.getAsString(), pattern.getAsString(), defaultGroup, result,
-            resultValueVector);
+        operation(value, pattern, defaultGroup, result, resultValueVector, dataPtr);
     }
 
-    static void regexExtract(const std::string& input, const std::string& pattern,
-        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector) {
-        RE2 regex(parseCypherPatten(pattern));
+    static void regexExtract(regex::StringPiece input, const RE2& regex, std::int64_t& group,
+        common::ku_string_t& result, common::ValueVector& resultValueVector) {
         auto submatchCount = regex.NumberOfCapturingGroups() + 1;
         if (group >= submatchCount) {
             throw common::RuntimeException("Regex match group index is out of range");
@@ -33,12 +34,12 @@ struct RegexpExtract : BaseRegexpOperation {
         std::vector<regex::StringPiece> targetSubMatches;
         targetSubMatches.resize(submatchCount);
 
-        if (!regex.Match(regex::StringPiece(input), 0, input.length(), RE2::UNANCHORED,
-                targetSubMatches.data(), submatchCount)) {
+        if (!regex.Match(input, 0, input.length(), RE2::UNANCHORED, targetSubMatches.data(),
+                submatchCount)) {
             return;
         }
 
-        copyToKuzuString(targetSubMatches[group].ToString(), result, resultValueVector);
+        copyToKuzuString(targetSubMatches[group], result, resultValueVector);
     }
 };
 
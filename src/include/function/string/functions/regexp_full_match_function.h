@@ -9,8 +9,9 @@ namespace function {
 
 struct RegexpFullMatch : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& left, common::ku_string_t& right,
-        uint8_t& result) {
-        result = RE2::FullMatch(left.getAsString(), parseCypherPatten(right.getAsString()));
+        uint8_t& result, void* dataPtr) {
+        std::unique_ptr<RE2> localPattern;
+        result = RE2::FullMatch(toStringPiece(left), getPattern(right, dataPtr, localPattern));
     }
 };
 
@@ -10,10 +10,11 @@ namespace function {
 struct RegexpReplace : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
         common::ku_string_t& replacement, common::ku_string_t& result,
-        common::ValueVector& resultValueVector) {
+        common::ValueVector& resultValueVector, void* dataPtr) {
+        std::unique_ptr<RE2> localPattern;
         std::string resultStr = value.getAsString();
-        RE2::Replace(&resultStr, parseCypherPatten(pattern.getAsString()),
-            replacement.getAsString());
+        RE2::Replace(&resultStr, getPattern(pattern, dataPtr, localPattern),
+            toStringPiece(replacement));
         copyToKuzuString(resultStr, result, resultValueVector);
     }
 };
@@ -163,24 +163,32 @@ struct RegexpFullMatchFunction : public VectorStringFunction {
     static constexpr const char* name = "REGEXP_FULL_MATCH";
 
     static function_set getFunctionSet();
+    static std::unique_ptr<FunctionBindData> bindFunc(const binder::expression_vector& arguments,
+        Function* function);
 };
 
 struct RegexpMatchesFunction : public VectorStringFunction {
     static constexpr const char* name = "REGEXP_MATCHES";
 
     static function_set getFunctionSet();
+    static std::unique_ptr<FunctionBindData> bindFunc(const binder::expression_vector& arguments,
+        Function* function);
 };
 
 struct RegexpReplaceFunction : public VectorStringFunction {
     static constexpr const char* name = "REGEXP_REPLACE";
 
     static function_set getFunctionSet();
+    static std::unique_ptr<FunctionBindData> bindFunc(const binder::expression_vector& arguments,
+        Function* function);
 };
 
 struct RegexpExtractFunction : public VectorStringFunction {
     static constexpr const char* name = "REGEXP_EXTRACT";
 
     static function_set getFunctionSet();
+    static std::unique_ptr<FunctionBindData> bindFunc(const binder::expression_vector& arguments,
+        Function* function);
 };
 
 struct RegexpExtractAllFunction : public VectorStringFunction {
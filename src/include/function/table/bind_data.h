@@ -3,6 +3,7 @@
 #include "common/copier_config/reader_config.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
+#include "storage/predicate/column_predicate.h"
 
 namespace kuzu {
 namespace common {
@@ -14,13 +15,18 @@ namespace function {
 struct TableFuncBindData {
     std::vector<common::LogicalType> columnTypes;
     std::vector<std::string> columnNames;
+    // Predicates on each output column pushed down by the optimizer. A table function may use them
+    // to skip input whose statistics show that no row can satisfy them. Rows are still filtered
+    // on top of the function.
+    std::vector<std::vector<storage::ColumnPredicate>> columnPredicates;
 
     TableFuncBindData() = default;
     TableFuncBindData(std::vector<common::LogicalType> columnTypes,
         std::vector<std::string> columnNames)
         : columnTypes{std::move(columnTypes)}, columnNames{std::move(columnNames)} {}
     TableFuncBindData(const TableFuncBindData& other)
-        : columnTypes{other.columnTypes}, columnNames{other.columnNames} {}
+        : columnTypes{other.columnTypes}, columnNames{other.columnNames},
+          columnPredicates{other.columnPredicates} {}
 
     virtual ~TableFuncBindData() = default;
 
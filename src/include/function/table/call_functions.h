@@ -104,5 +104,17 @@ struct CheckpointFunction final : public CallFunction {
     static function_set getFunctionSet();
 };
 
+struct CheckpointInfoFunction final : public CallFunction {
+    static constexpr const char* name = "CHECKPOINT_INFO";
+
+    static function_set getFunctionSet();
+};
+
+struct BufferManagerInfoFunction final : public CallFunction {
+    static constexpr const char* name = "BUFFER_MANAGER_INFO";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
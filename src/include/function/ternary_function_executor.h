@@ -30,6 +30,14 @@ struct TernaryListFunctionWrapper {
     }
 };
 
+struct TernaryStringBindDataFunctionWrapper {
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename OP>
+    static inline void operation(A_TYPE& a, B_TYPE& b, C_TYPE& c, RESULT_TYPE& result,
+        void* /*aValueVector*/, void* resultValueVector, void* dataPtr) {
+        OP::operation(a, b, c, result, *(common::ValueVector*)resultValueVector, dataPtr);
+    }
+};
+
 struct TernaryUDFFunctionWrapper {
     template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename OP>
     static inline void operation(A_TYPE& a, B_TYPE& b, C_TYPE& c, RESULT_TYPE& result,
@@ -425,6 +433,13 @@ struct TernaryFunctionExecutor {
             c, result, nullptr /* dataPtr */);
     }
 
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void executeStringWithBindData(common::ValueVector& a, common::ValueVector& b,
+        common::ValueVector& c, common::ValueVector& result, void* dataPtr) {
+        executeSwitch<A_TYPE, B_TYPE, C_TYPE, RESULT_TYPE, FUNC,
+            TernaryStringBindDataFunctionWrapper>(a, b, c, result, dataPtr);
+    }
+
     template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
     static void executeUDF(common::ValueVector& a, common::ValueVector& b, common::ValueVector& c,
         common::ValueVector& result, void* dataPtr) {
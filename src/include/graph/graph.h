@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "common/types/internal_id_t.h"
 
 namespace kuzu {
@@ -16,7 +18,15 @@ public:
 
     virtual common::offset_t getNumEdges() = 0;
 
-    virtual std::vector<common::nodeID_t> getNbrs(common::offset_t offset) = 0;
+    // Returns the offsets of the neighbours of the given node. All neighbours belong to the node
+    // table returned by getNodeTableID(). Unless stated otherwise by the implementation, the span is
+    // only valid until the next call on the graph.
+    virtual std::span<const common::offset_t> getNbrOffsets(common::offset_t offset) = 0;
+
+    virtual bool hasWeights() const { return false; }
+    // Returns the weights of the edges to the neighbours returned by getNbrOffsets(), in the same
+    // order. Empty if the graph has no weights.
+    virtual std::span<const double> getNbrWeights(common::offset_t) { return {}; }
 };
 
 } // namespace graph
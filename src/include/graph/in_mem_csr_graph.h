@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "graph.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/store/node_table.h"
+#include "storage/store/rel_table.h"
+
+namespace kuzu {
+namespace graph {
+
+// CSR of the nodes within one node group. Neighbour and weight buffers are not allocated if the
+// node group has no edge.
+struct InMemCSRSegment {
+    // numNodes + 1 entries. The neighbours of the i-th node of the segment are
+    // nbrOffsets[csrOffsets[i], csrOffsets[i + 1]).
+    std::unique_ptr<storage::MemoryBuffer> csrOffsets;
+    std::unique_ptr<storage::MemoryBuffer> nbrOffsets;
+    std::unique_ptr<storage::MemoryBuffer> weights;
+
+    const common::offset_t* getCSROffsets() const {
+        return reinterpret_cast<const common::offset_t*>(csrOffsets->buffer);
+    }
+    const common::offset_t* getNbrOffsets() const {
+        return reinterpret_cast<const common::offset_t*>(nbrOffsets->buffer);
+    }
+    const double* getWeights() const { return reinterpret_cast<const double*>(weights->buffer); }
+};
+
+// Projection of a node table and a rel table into memory, so that algorithms iterating over the
+// neighbours of every node many times do not pay for a rel table scan on each access. The graph is
+// empty after construction and must be populated by scan(). Once populated, the graph is read-only
+// and can be accessed concurrently, and spans returned by getNbrOffsets() and getNbrWeights() are
+// valid for the lifetime of the graph.
+class InMemoryCSRGraph : public Graph {
+public:
+    // If weightPropertyName is not empty, the given rel property is scanned as edge weights. It
+    // should be numerical.
+    InMemoryCSRGraph(main::ClientContext* context, const std::string& nodeName,
+        const std::string& relName, const std::string& weightPropertyName = "");
+
+    common::table_id_t getNodeTableID() override { return nodeTable->getTableID(); }
+
+    common::offset_t getNumNodes() override { return numNodes; }
+
+    common::offset_t getNumEdges() override { return numEdges.load(); }
+
+    std::span<const common::offset_t> getNbrOffsets(common::offset_t offset) override;
+
+    bool hasWeights() const override { return weightColumnID != common::INVALID_COLUMN_ID; }
+    std::span<const double> getNbrWeights(common::offset_t offset) override;
+
+    // Populates the graph. Threads calling scan() concurrently split the work by node group, and
+    // each of them returns once all node groups are scanned.
+    void scan();
+
+private:
+    void scanNodeGroup(common::node_group_idx_t nodeGroupIdx);
+
+    std::pair<const InMemCSRSegment*, common::offset_t> getSegment(common::offset_t offset) const {
+        return {&segments[offset >> common::StorageConstants::NODE_GROUP_SIZE_LOG2],
+            offset & (common::StorageConstants::NODE_GROUP_SIZE - 1)};
+    }
+
+private:
+    main::ClientContext* context;
+    storage::NodeTable* nodeTable;
+    storage::RelTable* relTable;
+    common::column_id_t weightColumnID;
+    std::unique_ptr<common::LogicalType> weightType;
+    common::offset_t numNodes;
+    std::atomic<common::offset_t> numEdges;
+    std::vector<InMemCSRSegment> segments;
+    // Scan dispatching.
+    std::atomic<common::node_group_idx_t> nextNodeGroupIdx;
+    std::mutex mtx;
+    std::condition_variable cv;
+    common::node_group_idx_t numScannedNodeGroups;
+    bool scanFailed;
+};
+
+} // namespace graph
+} // namespace kuzu
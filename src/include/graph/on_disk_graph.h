@@ -12,12 +12,16 @@ struct NbrScanState {
     std::shared_ptr<common::DataChunkState> dstNodeIDVectorState;
     std::unique_ptr<common::ValueVector> srcNodeIDVector;
     std::unique_ptr<common::ValueVector> dstNodeIDVector;
+    // Only set if a rel property is scanned together with the neighbours.
+    std::unique_ptr<common::ValueVector> propertyVector;
 
     static constexpr common::RelDataDirection direction = common::RelDataDirection::FWD;
     std::vector<common::column_id_t> columnIDs;
     std::unique_ptr<storage::RelTableScanState> fwdReadState;
 
     explicit NbrScanState(storage::MemoryManager* mm);
+    NbrScanState(storage::MemoryManager* mm, common::column_id_t propertyColumnID,
+        const common::LogicalType& propertyType);
 };
 
 class OnDiskGraph : public Graph {
@@ -31,13 +35,18 @@ public:
 
     common::offset_t getNumEdges() override;
 
-    std::vector<common::nodeID_t> getNbrs(common::offset_t offset) override;
+    std::span<const common::offset_t> getNbrOffsets(common::offset_t offset) override;
+
+private:
+    template<typename FUNC>
+    void scanNbrs(common::offset_t offset, FUNC func);
 
 private:
     main::ClientContext* context;
     storage::NodeTable* nodeTable;
     storage::RelTable* relTable;
     std::unique_ptr<NbrScanState> nbrScanState;
+    std::vector<common::offset_t> nbrOffsets;
 };
 
 } // namespace graph
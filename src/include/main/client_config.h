@@ -29,6 +29,17 @@ struct ClientConfig {
     common::PathSemantic recursivePatternSemantic;
     // Scale factor for recursive pattern cardinality estimation.
     uint32_t recursivePatternCardinalityScaleFactor;
+    // Memory (in bytes) the build side of a hash join can take before it is spilled to disk. 0
+    // disables spilling.
+    uint64_t hashJoinMemoryLimit;
+    // Memory (in bytes) partitioned tuples of a rel table COPY can take before they are spilled to
+    // disk. 0 disables spilling.
+    uint64_t copyRelMemoryLimit;
+    // If read-only queries return their result while they are still running, instead of after
+    // the whole result is materialized.
+    bool enableStreamingResult;
+
+    bool operator==(const ClientConfig& other) const = default;
 };
 
 struct ClientConfigDefault {
@@ -40,6 +51,11 @@ struct ClientConfigDefault {
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr common::PathSemantic RECURSIVE_PATTERN_SEMANTIC = common::PathSemantic::WALK;
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 1;
+    // Ratio of the buffer pool size.
+    static constexpr double HASH_JOIN_MEMORY_LIMIT_RATIO = 0.5;
+    // Ratio of the buffer pool size.
+    static constexpr double COPY_REL_MEMORY_LIMIT_RATIO = 0.5;
+    static constexpr bool ENABLE_STREAMING_RESULT = false;
 };
 
 } // namespace main
@@ -34,6 +34,7 @@ class DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+class StreamingQuery;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -70,7 +71,8 @@ public:
     void setQueryTimeOut(uint64_t timeoutInMS);
     uint64_t getQueryTimeOut() const;
     void startTimer();
-    uint64_t getTimeoutRemainingInMS() const;
+    // Time left of the active query if it runs with the given timeout.
+    uint64_t getTimeoutRemainingInMS(uint64_t timeoutInMS) const;
     void resetActiveQuery() { activeQuery.reset(); }
 
     // Parallelism
@@ -142,6 +144,12 @@ private:
         std::optional<std::unordered_map<std::string, std::shared_ptr<common::Value>>> inputParams =
             std::nullopt);
 
+    // Starts an auto transaction, or validates the active manual transaction, for a statement.
+    void beginTransactionNoLock(bool readOnlyStatement);
+
+    bool canReuseCachedPlanNoLock(const PreparedStatement& preparedStatement) const;
+    std::unique_ptr<QueryResult> executeCachedPlanNoLock(PreparedStatement* preparedStatement);
+
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> params,
@@ -158,6 +166,16 @@ private:
     std::unique_ptr<QueryResult> executeAndAutoCommitIfNecessaryNoLock(
         PreparedStatement* preparedStatement, uint32_t planIdx = 0u, bool requiredNexTx = true);
 
+    // Streaming result.
+    bool canStreamResultNoLock(const PreparedStatement& preparedStatement) const;
+    // Starts the query on a background thread and returns a result that reads the query's output
+    // while the query runs. The query commits its auto transaction once it completes.
+    std::unique_ptr<QueryResult> executeStreamingNoLock(
+        std::unique_ptr<PreparedStatement> preparedStatement);
+    // Stops the streaming query of the previous statement, if any, so that its transaction is
+    // closed before the next statement starts.
+    void closeStreamingQueryNoLock();
+
     void runFuncInTransaction(const std::function<void(void)>& fun);
     void addScalarFunction(std::string name, function::function_set definitions);
     void removeScalarFunction(std::string name);
@@ -188,6 +206,8 @@ private:
     AttachedKuzuDatabase* remoteDatabase;
     // Progress bar for queries
     std::unique_ptr<common::ProgressBar> progressBar;
+    // Query of the last statement if its result is streamed.
+    std::shared_ptr<StreamingQuery> streamingQuery;
     std::mutex mtx;
 };
 
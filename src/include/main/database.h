@@ -57,15 +57,30 @@ struct KUZU_API SystemConfig {
      * environment. This will be removed once we implemente a better solution later. The value is
      * default to 1 << 43 (8TB) under 64-bit environment and 1GB under 32-bit one (see
      * `DEFAULT_VM_REGION_MAX_SIZE`).
+     * @param scanResistantEviction If true, pages read from disk are first kept in a probation
+     * queue of the buffer pool and only join the main eviction queue once accessed again, so that
+     * large scans do not evict the pages other queries keep accessing. If false, the buffer pool
+     * evicts pages in FIFO order with a second chance for pages accessed since they were enqueued.
+     * @param readAheadNumPages The number of pages a sequential column scan loads with a single read
+     * when it reaches a page that is not cached. 0 or 1 disables read-ahead. The value is default
+     * to 32 (see `DEFAULT_READ_AHEAD_NUM_PAGES`).
+     * @param asyncReadAhead If true, a sequential column scan also submits the read of the next
+     * read-ahead window to background threads, so that the window is read while the scan processes
+     * the current one.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
-        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u);
+        bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
+        bool scanResistantEviction = false, uint64_t readAheadNumPages = -1u,
+        bool asyncReadAhead = false);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    bool scanResistantEviction;
+    uint64_t readAheadNumPages;
+    bool asyncReadAhead;
 };
 
 /**
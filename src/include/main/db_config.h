@@ -61,6 +61,9 @@ public:
     bool enableCompression;
     bool readOnly;
     uint64_t maxDBSize;
+    bool scanResistantEviction;
+    uint64_t readAheadNumPages;
+    bool asyncReadAhead;
     bool enableMultiWrites = false;
 };
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "common/types/types.h"
+#include "main/client_config.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace main {
+
+class PreparedStatement;
+
+/**
+ * A statement bound, planned and optimized during a previous execution of a prepared statement.
+ * Parameter expressions in the cached plan read their values from the prepared statement's
+ * parameter map, so the plan can be re-executed with new parameter values as long as nothing that
+ * influenced binding and planning has changed.
+ */
+struct CachedPreparedPlan {
+    std::unique_ptr<PreparedStatement> statement;
+    // Binding and planning depend on the catalog (and its version), client configs (e.g. var
+    // length max depth, recursive pattern semantic) and the data types of parameters.
+    catalog::Catalog* catalog = nullptr;
+    uint64_t catalogVersion = 0;
+    ClientConfig clientConfig;
+    std::unordered_map<std::string, common::LogicalType> parameterTypes;
+};
+
+} // namespace main
+} // namespace kuzu
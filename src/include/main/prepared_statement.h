@@ -13,6 +13,8 @@
 namespace kuzu {
 namespace main {
 
+struct CachedPreparedPlan;
+
 /**
  * @brief A prepared statement is a parameterized query which can avoid planning the same query for
  * repeated execution.
@@ -58,6 +60,8 @@ private:
     std::unique_ptr<binder::BoundStatementResult> statementResult;
     std::vector<std::unique_ptr<planner::LogicalPlan>> logicalPlans;
     std::shared_ptr<parser::Statement> parsedStatement;
+    // Plan bound during the last execution, reused by following executions when still valid.
+    std::unique_ptr<CachedPreparedPlan> cachedPlan;
 };
 
 } // namespace main
@@ -10,14 +10,21 @@
 #include "query_summary.h"
 
 namespace kuzu {
+namespace common {
+class ArrowRowBatch;
+} // namespace common
+
 namespace main {
 
+class StreamingQuery;
+
 /**
  * @brief QueryResult stores the result of a query execution.
  */
 class QueryResult {
     friend class Connection;
     friend class ClientContext;
+    friend class common::ArrowRowBatch;
     class QueryResultIterator {
     private:
         QueryResult* currentResult;
@@ -72,7 +79,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streamed result, throws if the query has not
+     * completed yet.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -104,7 +112,7 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. A streamed result cannot be reset.
      */
     KUZU_API void resetIterator();
 
@@ -133,8 +141,14 @@ public:
     KUZU_API std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize);
 
 private:
+    void initColumns(const std::vector<std::shared_ptr<binder::Expression>>& columns);
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_,
-        const std::vector<std::shared_ptr<binder::Expression>>& columns);
+        const std::vector<std::shared_ptr<binder::Expression>>& columns, uint64_t numThreads_);
+    void initStreamingResult(std::shared_ptr<StreamingQuery> streamingQuery_,
+        const std::vector<std::shared_ptr<binder::Expression>>& columns, uint64_t numThreads_);
+    // A streamed result is read one chunk at a time. Replaces the current chunk with the next one
+    // once all its tuples are read.
+    void fetchNextChunkIfNecessary();
     void validateQuerySucceed() const;
 
 private:
@@ -149,6 +163,11 @@ private:
     std::shared_ptr<processor::FactorizedTable> factorizedTable;
     std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    // Set if the result is streamed, in which case factorizedTable holds the current chunk of the
+    // result only.
+    std::shared_ptr<StreamingQuery> streamingQuery;
+    // Number of threads of the client, which may be used to convert the result to arrow.
+    uint64_t numThreads = 1;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
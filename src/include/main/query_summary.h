@@ -12,6 +12,8 @@ namespace main {
 struct PreparedSummary {
     double compilingTime = 0;
     common::StatementType statementType;
+    // Whether binding and planning were skipped by reusing a cached plan.
+    bool planCacheHit = false;
 };
 
 /**
@@ -19,6 +21,7 @@ struct PreparedSummary {
  */
 class QuerySummary {
     friend class ClientContext;
+    friend class QueryResult;
     friend class benchmark::Benchmark;
 
 public:
@@ -30,6 +33,18 @@ public:
      * @return query execution time in milliseconds.
      */
     KUZU_API double getExecutionTime() const;
+    /**
+     * @return time in milliseconds from the start of the execution until the first tuple of the
+     * result is available. It equals the execution time unless the result is streamed. The
+     * execution time of a streamed result is only known once the query completes.
+     */
+    KUZU_API double getTimeToFirstTuple() const;
+
+    /**
+     * @return true if the query reused the plan cached by a previous execution of the same
+     * prepared statement, i.e. binding and planning were skipped.
+     */
+    KUZU_API bool isPlanCacheHit() const;
 
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
@@ -40,6 +55,7 @@ public:
 
 private:
     double executionTime = 0;
+    double timeToFirstTuple = 0;
     PreparedSummary preparedSummary;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
 #include "common/types/value/value.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
@@ -7,6 +9,14 @@
 namespace kuzu {
 namespace main {
 
+// Sizes and limits are given as INT64 but stored unsigned.
+static inline void validateNonNegative(const char* name, const common::Value& parameter) {
+    if (parameter.getValue<int64_t>() < 0) {
+        throw common::RuntimeException(common::stringFormat(
+            "{} must be non-negative, but {} was given.", name, parameter.toString()));
+    }
+}
+
 struct ThreadsSetting {
     static constexpr const char* name = "threads";
     static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
@@ -135,6 +145,44 @@ struct RecursivePatternFactorSetting {
     }
 };
 
+struct HashJoinMemoryLimitSetting {
+    static constexpr const char* name = "hash_join_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        validateNonNegative(name, parameter);
+        context->getClientConfigUnsafe()->hashJoinMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->hashJoinMemoryLimit);
+    }
+};
+
+struct CopyRelMemoryLimitSetting {
+    static constexpr const char* name = "copy_rel_memory_limit";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        validateNonNegative(name, parameter);
+        context->getClientConfigUnsafe()->copyRelMemoryLimit = parameter.getValue<int64_t>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->copyRelMemoryLimit);
+    }
+};
+
+struct EnableStreamingResultSetting {
+    static constexpr const char* name = "enable_streaming_result";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableStreamingResult = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableStreamingResult);
+    }
+};
+
 struct EnableMVCCSetting {
     static constexpr const char* name = "enable_multi_writes";
     static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::BOOL;
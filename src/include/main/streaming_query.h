@@ -0,0 +1,45 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "common/copy_constructors.h"
+#include "processor/result/result_chunk_queue.h"
+
+namespace kuzu {
+namespace main {
+
+class ClientContext;
+
+/*
+ * A StreamingQuery runs a read-only query on a background thread, while its QueryResult reads the
+ * result from the chunk queue. The query is closed when its QueryResult is destructed or when
+ * another statement runs on the same connection. Closing a query that is still running stops it.
+ */
+class StreamingQuery {
+public:
+    StreamingQuery(ClientContext* clientContext,
+        std::shared_ptr<processor::ResultChunkQueue> chunkQueue)
+        : clientContext{clientContext}, chunkQueue{std::move(chunkQueue)}, closed{false} {}
+    DELETE_COPY_AND_MOVE(StreamingQuery);
+    ~StreamingQuery();
+
+    // Runs executeFunc on the background thread. executeFunc must finish the chunk queue.
+    void start(std::function<void()> executeFunc);
+
+    // Stops the query if it is still running and waits for the background thread to exit.
+    void close();
+
+    processor::ResultChunkQueue* getChunkQueue() const { return chunkQueue.get(); }
+
+private:
+    ClientContext* clientContext;
+    std::shared_ptr<processor::ResultChunkQueue> chunkQueue;
+    std::mutex mtx;
+    bool closed;
+    std::thread thread;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -52,6 +52,15 @@ private:
     std::shared_ptr<planner::LogicalOperator> visitCrossProductReplace(
         const std::shared_ptr<planner::LogicalOperator>& op);
 
+    // Attach comparisons between a scanned property and a constant to SCAN_NODE_TABLE so that
+    // node groups can be skipped based on column statistics. Predicates are still applied by
+    // filters on top of the scan.
+    std::shared_ptr<planner::LogicalOperator> visitScanNodeTableReplace(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+    // Same as above for SCAN_FILE, so that file readers can skip data based on file statistics.
+    std::shared_ptr<planner::LogicalOperator> visitScanFileReplace(
+        const std::shared_ptr<planner::LogicalOperator>& op);
+
     // TODO(Xiyang/Guodong): This should be reworked for pushing filters into ScanNodeTable.
     //                       Also, should be reworked for IndexScan.
     // Push FILTER into SCAN_NODE_TABLE, and turn index lookup into INDEX_SCAN.
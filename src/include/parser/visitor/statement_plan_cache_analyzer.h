@@ -0,0 +1,30 @@
+#pragma once
+
+#include "parser/parsed_statement_visitor.h"
+
+namespace kuzu {
+namespace parser {
+
+// Decides if the plan of a prepared statement can be cached and reused across executions. Only
+// queries are cached. Reading external sources (LOAD FROM, CALL table functions) is excluded
+// because their output schema is resolved during binding and may change between executions.
+class StatementPlanCacheAnalyzer final : public StatementVisitor {
+public:
+    StatementPlanCacheAnalyzer() : StatementVisitor{}, cacheable{true} {}
+
+    bool isCacheable(const Statement& statement);
+
+private:
+    inline void visitInQueryCall(const ReadingClause* /*readingClause*/) override {
+        cacheable = false;
+    }
+    inline void visitLoadFrom(const ReadingClause* /*readingClause*/) override {
+        cacheable = false;
+    }
+
+private:
+    bool cacheable;
+};
+
+} // namespace parser
+} // namespace kuzu
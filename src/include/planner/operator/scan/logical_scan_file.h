@@ -18,11 +18,20 @@ public:
     bool hasOffset() const { return offset != nullptr; }
     std::shared_ptr<binder::Expression> getOffset() const { return offset; }
 
+    // Predicates that are evaluated by a filter on top of the scan. Scan uses them to skip parts of
+    // the file (e.g. parquet row groups) whose statistics show that no row can satisfy them.
+    void setColumnPredicates(binder::expression_vector predicates) {
+        columnPredicates = std::move(predicates);
+    }
+    binder::expression_vector getColumnPredicates() const { return columnPredicates; }
+
     void computeFactorizedSchema() final;
     void computeFlatSchema() final;
 
     std::unique_ptr<LogicalOperator> copy() final {
-        return std::make_unique<LogicalScanFile>(info.copy(), offset);
+        auto op = std::make_unique<LogicalScanFile>(info.copy(), offset);
+        op->columnPredicates = columnPredicates;
+        return op;
     }
 
 private:
@@ -30,6 +39,7 @@ private:
     // ScanFile may be used as a source operator for COPY pipeline. In such case, row offset needs
     // to be provided in order to generate internal ID.
     std::shared_ptr<binder::Expression> offset;
+    binder::expression_vector columnPredicates;
 };
 
 } // namespace planner
@@ -55,6 +55,13 @@ public:
     }
     bool hasRecursiveJoinScanInfo() const { return recursiveJoinScanInfo != nullptr; }
 
+    // Predicates that are evaluated by a filter on top of the scan. Scan uses them to skip node
+    // groups whose statistics show that no tuple can satisfy them.
+    void setPropertyPredicates(binder::expression_vector predicates) {
+        propertyPredicates = std::move(predicates);
+    }
+    binder::expression_vector getPropertyPredicates() const { return propertyPredicates; }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
 private:
@@ -63,6 +70,7 @@ private:
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
     std::unique_ptr<RecursiveJoinScanInfo> recursiveJoinScanInfo;
+    binder::expression_vector propertyPredicates;
 };
 
 } // namespace planner
@@ -9,9 +9,13 @@ namespace processor {
 struct ExecutionContext {
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Config of the client when the query starts. A streaming query keeps running after the
+    // statement returns, while the config of the client may change, so operators read this copy.
+    main::ClientConfig clientConfig;
 
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext)
-        : profiler{profiler}, clientContext{clientContext} {}
+        : profiler{profiler}, clientContext{clientContext},
+          clientConfig{*clientContext->getClientConfig()} {}
 };
 
 } // namespace processor
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "aggregate_input.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
 #include "function/aggregate_function.h"
 #include "processor/result/base_hash_table.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -80,11 +82,32 @@ public:
         const std::vector<common::ValueVector*>& groupByKeyVectors,
         common::ValueVector* aggregateVector);
 
-    //! merge aggregate hash table by combining aggregate states under the same key
-    void merge(AggregateHashTable& other);
+    //! merge the given entries of other aggregate hash table by combining aggregate states under
+    //! the same key
+    void merge(AggregateHashTable& other, std::vector<uint8_t*>& entries);
+
+    //! create an empty aggregate hash table with the same schema and aggregate functions
+    virtual std::unique_ptr<AggregateHashTable> createEmptyCopy(
+        uint64_t numEntriesToAllocate) const;
+
+    common::hash_t getHash(const uint8_t* entry) const {
+        return *(common::hash_t*)(entry + hashColOffsetInFT);
+    }
 
     void finalizeAggregateStates();
 
+    //! entries can be spilled if no aggregate is distinct and all aggregate states can be moved by
+    //! copying their bytes
+    bool canSpill() const;
+
+    //! serialize the given entries, which can be merged into a hash table with the same schema by
+    //! mergeSerializedEntries() after this hash table is released
+    void serializeEntries(std::vector<uint8_t*>& entries, common::Serializer& serializer);
+
+    void mergeSerializedEntries(common::Deserializer& deserializer, uint64_t numEntries);
+
+    uint64_t getMemoryUsage() const;
+
     void resize(uint64_t newSize);
 
 protected:
@@ -112,6 +135,12 @@ private:
 
     void initializeTmpVectors();
 
+    //! vectors to read group by keys (hash keys followed by non-hash keys) of entries into
+    std::vector<std::unique_ptr<common::ValueVector>> createKeyVectors(
+        const std::shared_ptr<common::DataChunkState>& state,
+        std::vector<common::ValueVector*>& groupByHashVectors,
+        std::vector<common::ValueVector*>& groupByNonHashVectors);
+
     // ! This function will only be used by distinct aggregate, which assumes that all groupByKeys
     // are flat.
     uint8_t* findEntryInDistinctHT(const std::vector<common::ValueVector*>& groupByKeyVectors,
@@ -213,10 +242,11 @@ protected:
     std::unique_ptr<uint64_t[]> noMatchIdxes;
     std::unique_ptr<uint64_t[]> entryIdxesToInitialize;
     std::unique_ptr<HashSlot*[]> hashSlotsToUpdateAggState;
+    std::vector<common::LogicalType> payloadTypes;
 
 private:
-    std::vector<common::LogicalType> payloadTypes;
     std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions;
+    std::vector<common::LogicalType> distinctAggKeyTypes;
 
     //! special handling of distinct aggregate
     std::vector<std::unique_ptr<AggregateHashTable>> distinctHashTables;
@@ -12,8 +12,6 @@ protected:
     explicit BaseAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions);
 
-    virtual std::pair<uint64_t, uint64_t> getNextRangeToRead() = 0;
-
     ~BaseAggregateSharedState() = default;
 
 protected:
@@ -1,36 +1,95 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+
 #include "aggregate_hash_table.h"
 #include "processor/operator/aggregate/base_aggregate.h"
+#include "processor/result/spill_file.h"
 
 namespace kuzu {
 namespace processor {
 
+// Entries spilled from a local aggregate hash table that fall into one radix bucket.
+struct SpilledAggregateBucket {
+    std::unique_ptr<SpillFile> file;
+    uint64_t numEntries = 0;
+};
+
+// Local aggregate hash tables are radix partitioned by the high bits of their hash values at the
+// end of the build phase. Each partition is then merged across local hash tables and finalized by
+// the first thread scanning it, so that merging and scanning both run in parallel.
+// Local hash tables running out of memory during the build phase are spilled to disk with the same
+// radix partitioning, and spilled entries are re-aggregated when merging their partition. Merged
+// partitions are released once scanned, so that only a few of them are in memory at a time.
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): This is a final class.
 class HashAggregateSharedState final : public BaseAggregateSharedState {
+    static constexpr uint64_t NUM_RADIX_BITS = 6;
+    static constexpr uint64_t NUM_BUCKETS = (uint64_t)1 << NUM_RADIX_BITS;
+    // Partitions are only split further if each of them keeps at least this many entries.
+    static constexpr uint64_t MIN_NUM_ENTRIES_PER_PARTITION = common::DEFAULT_VECTOR_CAPACITY;
+
+    struct LocalHashTable {
+        std::unique_ptr<AggregateHashTable> hashTable;
+        // Entries of the hash table per radix bucket.
+        std::vector<std::vector<uint8_t*>> buckets;
+        // Entries spilled before the hash table was appended, per radix bucket. Empty if nothing
+        // was spilled.
+        std::vector<SpilledAggregateBucket> spilledBuckets;
+    };
+
+    struct Partition {
+        // Set once the partition is merged and finalized, and reset once all of it is scanned.
+        std::shared_ptr<AggregateHashTable> hashTable;
+        uint64_t nextOffsetToScan = 0;
+    };
 
 public:
     explicit HashAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
+        : BaseAggregateSharedState{aggregateFunctions}, numEntriesUpperBound{0},
+          numBucketsPerPartition{NUM_BUCKETS}, hasSpilledEntries{false},
+          nextPartitionIdxToMerge{0}, numMergingPartitions{0}, mergeFailed{false},
+          numScannedPartitions{0} {}
 
-    void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
+    void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable,
+        std::vector<SpilledAggregateBucket> spilledBuckets);
 
-    void combineAggregateHashTable(storage::MemoryManager& memoryManager);
+    // Writes all entries of the given hash table to the spill file of their radix bucket, and
+    // returns the number of bytes written. The hash table should be released afterwards.
+    static uint64_t spillAggregateHashTable(AggregateHashTable& aggregateHashTable,
+        std::vector<SpilledAggregateBucket>& spilledBuckets, main::ClientContext* context);
 
-    void finalizeAggregateHashTable();
+    // Must be called once all local hash tables are appended.
+    void initPartitions();
 
-    std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    // Assigns the next range [startOffset, endOffset) of entries to scan and returns the hash table
+    // of the partition they belong to, or nullptr if all partitions are scanned.
+    std::shared_ptr<AggregateHashTable> getNextRangeToRead(uint64_t& startOffset,
+        uint64_t& endOffset);
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
+    // The same key may appear in multiple local hash tables, so the number of entries after
+    // merging can be smaller.
+    uint64_t getNumEntriesUpperBound() const { return numEntriesUpperBound; }
 
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+    double getProgress() const;
+
+private:
+    static uint64_t getBucketIdx(common::hash_t hash) { return hash >> (64 - NUM_RADIX_BITS); }
 
-    uint64_t getCurrentOffset() const { return currentOffset; }
+    std::unique_ptr<AggregateHashTable> mergePartition(uint64_t partitionIdx);
 
 private:
-    std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
-    std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+    std::vector<LocalHashTable> localHashTables;
+    std::vector<Partition> partitions;
+    uint64_t numEntriesUpperBound;
+    uint64_t numBucketsPerPartition;
+    bool hasSpilledEntries;
+    uint64_t nextPartitionIdxToMerge;
+    uint64_t numMergingPartitions;
+    bool mergeFailed;
+    std::condition_variable cv;
+    std::atomic<uint64_t> numScannedPartitions;
 };
 
 struct HashAggregateInfo {
@@ -52,6 +111,7 @@ struct HashAggregateLocalState {
     std::vector<common::ValueVector*> dependentKeyVectors;
     common::DataChunkState* leadingState;
     std::unique_ptr<AggregateHashTable> aggregateHashTable;
+    std::vector<SpilledAggregateBucket> spilledBuckets;
 
     void init(ResultSet& resultSet, main::ClientContext* context, HashAggregateInfo& info,
         std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
@@ -60,6 +120,10 @@ struct HashAggregateLocalState {
 };
 
 class HashAggregate : public BaseAggregate {
+    // Each thread spills its local hash table once it takes more than an even share of this ratio
+    // of the buffer pool.
+    static constexpr double SPILL_MEMORY_RATIO = 0.5;
+
 public:
     HashAggregate(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::shared_ptr<HashAggregateSharedState> sharedState, HashAggregateInfo hashInfo,
@@ -68,7 +132,8 @@ public:
         const std::string& paramsString)
         : BaseAggregate{std::move(resultSetDescriptor), std::move(aggregateFunctions),
               std::move(aggInfos), std::move(child), id, paramsString},
-          hashInfo{std::move(hashInfo)}, sharedState{std::move(sharedState)} {}
+          hashInfo{std::move(hashInfo)}, sharedState{std::move(sharedState)},
+          spillMemoryLimit{0}, spilledBytes{nullptr} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -76,15 +141,24 @@ public:
 
     void finalize(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashAggregate>(resultSetDescriptor->copy(), sharedState, hashInfo,
             cloneAggFunctions(), copyVector(aggInfos), children[0]->clone(), id, paramsString);
     }
 
+private:
+    std::string getSpilledBytesMetricKey() const { return "spilledBytes-" + std::to_string(id); }
+
 private:
     HashAggregateInfo hashInfo;
     HashAggregateLocalState localState;
     std::shared_ptr<HashAggregateSharedState> sharedState;
+    // 0 if the local hash table cannot be spilled.
+    uint64_t spillMemoryLimit;
+    common::NumericMetric* spilledBytes;
 };
 
 } // namespace processor
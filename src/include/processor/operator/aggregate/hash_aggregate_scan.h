@@ -38,6 +38,8 @@ public:
 private:
     std::vector<DataPos> groupByKeyVectorsPos;
     std::vector<common::ValueVector*> groupByKeyVectors;
+    // Hash table of the range being scanned, kept alive until the next range is assigned.
+    std::shared_ptr<AggregateHashTable> hashTable;
     std::shared_ptr<HashAggregateSharedState> sharedState;
     std::vector<uint32_t> groupByKeyVectorsColIdxes;
 };
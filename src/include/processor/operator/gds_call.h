@@ -2,7 +2,7 @@
 
 #include "binder/expression/expression.h"
 #include "function/gds/gds.h"
-#include "graph/graph.h"
+#include "graph/in_mem_csr_graph.h"
 #include "processor/operator/sink.h"
 
 namespace kuzu {
@@ -11,7 +11,10 @@ namespace processor {
 struct GDSCallSharedState {
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> fTable;
-    std::unique_ptr<graph::Graph> graph;
+    std::unique_ptr<graph::InMemoryCSRGraph> graph;
+    std::shared_ptr<function::GDSSharedState> gdsSharedState;
+    // Set by the thread executing a non-parallel algorithm.
+    std::atomic<bool> execClaimed = false;
 
     explicit GDSCallSharedState(std::shared_ptr<FactorizedTable> fTable)
         : fTable{std::move(fTable)} {}
@@ -42,7 +45,9 @@ public:
 
     bool isSource() const override { return true; }
 
-    bool isParallel() const override { return false; }
+    // The graph is always scanned by all threads. Non-parallel algorithms are then executed by a
+    // single one of them.
+    bool isParallel() const override { return true; }
 
     void initLocalStateInternal(ResultSet*, ExecutionContext*) override;
 
@@ -5,32 +5,88 @@
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/result_set.h"
+#include "processor/result/spill_file.h"
 
 namespace kuzu {
 namespace processor {
 
 class HashJoinBuild;
 
+// Build side tuples falling into one partition once the hash table is spilled.
+struct SpilledJoinPartition {
+    std::mutex mtx;
+    std::unique_ptr<SpillFile> file;
+    uint64_t numTuples = 0;
+    // Hash table rebuilt from the spill file, shared by the probe threads probing the partition at
+    // the same time. It is released once none of them needs it any more.
+    std::weak_ptr<JoinHashTable> hashTable;
+};
+
 // This is a shared state between HashJoinBuild and HashJoinProbe operators.
 // Each clone of these two operators will share the same state.
 // Inside the state, we keep the materialized tuples in factorizedTable, which are merged by each
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+// If spilling is enabled and the build side runs out of its memory limit, all build side tuples are
+// instead partitioned by the high bits of their hash values into spill files, and the global hash
+// table is left empty. The probe side is then partitioned the same way, and each partition is
+// joined on its own (i.e. grace hash join).
 class HashJoinSharedState {
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 6;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+        : hashTable{std::move(hashTable)}, memoryLimit{0} {};
 
     virtual ~HashJoinSharedState() = default;
 
-    void mergeLocalHashTable(JoinHashTable& localHashTable);
+    // Allows the build side to be spilled once it takes more than memoryLimit bytes. Key and
+    // payload columns of the hash table must all be flat.
+    void enableSpilling(uint64_t memoryLimit, std::vector<common::LogicalType> keyTypes,
+        std::vector<common::LogicalType> payloadTypes);
+    // 0 if spilling is not enabled.
+    uint64_t getMemoryLimit() const { return memoryLimit; }
+
+    // Both functions return the number of tuples spilled.
+    uint64_t mergeLocalHashTable(JoinHashTable& localHashTable, main::ClientContext* context);
+    uint64_t spillLocalHashTable(JoinHashTable& localHashTable, main::ClientContext* context);
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    // Must not be called before the build side is finished.
+    bool isSpilled() const { return !partitions.empty(); }
+    static uint64_t getNumPartitions() { return NUM_PARTITIONS; }
+    static uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - NUM_PARTITIONS_LOG2);
+    }
+    // Returns the hash table of the given partition, which is rebuilt from its spill file unless
+    // another thread is still probing it.
+    std::shared_ptr<JoinHashTable> getPartitionHashTable(uint64_t partitionIdx,
+        main::ClientContext* context);
+
+private:
+    uint64_t spillHashTable(JoinHashTable& table, main::ClientContext* context);
+    void serializeTuple(const FactorizedTable& factorizedTable, const uint8_t* tuple,
+        const std::vector<std::unique_ptr<common::ValueVector>>& vectors,
+        common::Serializer& serializer) const;
+    void deserializeTuple(FactorizedTable& factorizedTable,
+        const std::vector<std::unique_ptr<common::ValueVector>>& vectors,
+        common::Deserializer& deserializer) const;
+    std::vector<std::unique_ptr<common::ValueVector>> createColumnVectors(
+        storage::MemoryManager* memoryManager) const;
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+private:
+    uint64_t memoryLimit;
+    // Types of the key columns followed by the payload columns.
+    std::vector<common::LogicalType> columnTypes;
+    // Empty unless the hash table is spilled.
+    std::vector<std::unique_ptr<SpilledJoinPartition>> partitions;
 };
 
 class HashJoinBuildInfo {
@@ -72,7 +128,8 @@ public:
         std::unique_ptr<HashJoinBuildInfo> info, std::unique_ptr<PhysicalOperator> child,
         uint32_t id, const std::string& paramsString)
         : Sink{std::move(resultSetDescriptor), operatorType, std::move(child), id, paramsString},
-          sharedState{std::move(sharedState)}, info{std::move(info)} {}
+          sharedState{std::move(sharedState)}, info{std::move(info)}, localMemoryLimit{0},
+          spilledTuples{nullptr} {}
 
     inline std::shared_ptr<HashJoinSharedState> getSharedState() const { return sharedState; }
 
@@ -81,6 +138,9 @@ public:
     void executeInternal(ExecutionContext* context) override;
     void finalize(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashJoinBuild>(resultSetDescriptor->copy(), sharedState, info->copy(),
             children[0]->clone(), id, paramsString);
@@ -94,6 +154,10 @@ protected:
 private:
     void setKeyState(common::DataChunkState* state);
 
+    std::string getSpilledTuplesMetricKey() const {
+        return "spilledTuples-" + std::to_string(id);
+    }
+
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     std::unique_ptr<HashJoinBuildInfo> info;
@@ -104,6 +168,10 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+    // Each thread spills its local hash table once it takes more than an even share of the memory
+    // limit of the shared state. 0 if spilling is not enabled.
+    uint64_t localMemoryLimit;
+    common::NumericMetric* spilledTuples;
 };
 
 } // namespace processor
@@ -35,6 +35,7 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +44,14 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Vectors of the probe side input grouped by data chunk, which are spilled along with the
+    // probe keys if the build side is spilled.
+    std::vector<DataPos> probeSideDataPos;
+};
+
+struct ProbeSideChunk {
+    common::DataChunkState* state;
+    std::vector<common::ValueVector*> vectors;
 };
 
 // Probe side on left, i.e. children[0] and build side on right, i.e. children[1]
@@ -55,7 +64,8 @@ public:
         : PhysicalOperator{PhysicalOperatorType::HASH_JOIN_PROBE, std::move(probeChild),
               std::move(buildChild), id, paramsString},
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
-          probeDataInfo{probeDataInfo} {}
+          probeDataInfo{probeDataInfo}, hashTable{nullptr}, probeSideExhausted{false},
+          nextPartitionIdxToProbe{0}, spilledTuples{nullptr} {}
 
     // This constructor is used for cloning only.
     HashJoinProbe(std::shared_ptr<HashJoinSharedState> sharedState, common::JoinType joinType,
@@ -64,18 +74,36 @@ public:
         : PhysicalOperator{PhysicalOperatorType::HASH_JOIN_PROBE, std::move(probeChild), id,
               paramsString},
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
-          probeDataInfo{probeDataInfo} {}
+          probeDataInfo{probeDataInfo}, hashTable{nullptr}, probeSideExhausted{false},
+          nextPartitionIdxToProbe{0}, spilledTuples{nullptr} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashJoinProbe>(sharedState, joinType, flatProbe, probeDataInfo,
             children[0]->clone(), id, paramsString);
     }
 
 private:
+    // If the build side is spilled, the probe side input is spilled to the partitions of its keys
+    // until it is exhausted, and then read back partition by partition.
+    bool getNextProbeInput(ExecutionContext* context);
+    // Returns false if the input has to be probed right away, which is the case for flat NULL keys.
+    bool spillProbeInput(main::ClientContext* context);
+    // If keyPositions is not null, only the given positions of the key chunk are spilled.
+    void spillProbeInputToPartition(uint64_t partitionIdx,
+        const std::vector<common::sel_t>* keyPositions, main::ClientContext* context);
+    bool readSpilledProbeInput(main::ClientContext* context);
+
+    std::string getSpilledTuplesMetricKey() const {
+        return "spilledTuples-" + std::to_string(id);
+    }
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -108,6 +136,19 @@ private:
 
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
+
+    // Hash table being probed, which is the hash table of a partition if the build side is
+    // spilled.
+    JoinHashTable* hashTable;
+    std::shared_ptr<JoinHashTable> partitionHashTable;
+    // Only used if the build side is spilled.
+    std::vector<ProbeSideChunk> probeSideChunks;
+    std::vector<std::unique_ptr<SpillFile>> spilledProbeInputs;
+    bool probeSideExhausted;
+    uint64_t nextPartitionIdxToProbe;
+    std::unique_ptr<SpillFile> spilledProbeInputToRead;
+    std::unique_ptr<common::Deserializer> spilledProbeInputReader;
+    common::NumericMetric* spilledTuples;
 };
 
 } // namespace processor
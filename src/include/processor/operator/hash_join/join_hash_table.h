@@ -23,8 +23,16 @@ public:
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
 
+    std::unique_ptr<JoinHashTable> createEmptyCopy() const {
+        return std::make_unique<JoinHashTable>(memoryManager, common::LogicalType::copy(keyTypes),
+            tableSchema->copy());
+    }
+
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector* hashVector,
         common::ValueVector* tmpHashVector, uint8_t** probedTuples);
+    // Computes the hashes of selected probe keys, which are NULL_HASH for NULL keys.
+    static void computeProbeHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector* hashVector, common::ValueVector* tmpHashVector);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
     // given key tuple.
     common::sel_t matchFlatKeys(const std::vector<common::ValueVector*>& keyVectors,
@@ -39,6 +47,11 @@ public:
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
     uint64_t getNumTuples() { return factorizedTable->getNumTuples(); }
+    // Hash slots are not accounted for since they are only allocated once all tuples are appended.
+    uint64_t getMemoryUsage() const { return factorizedTable->getMemoryUsage(); }
+    common::hash_t getHash(const uint8_t* tuple) const {
+        return *(common::hash_t*)(tuple + getHashValueColOffset());
+    }
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
@@ -35,6 +35,7 @@ private:
 
     common::ValueVector* indexVector;
     common::ValueVector* outVector;
+    std::unique_ptr<common::offset_t[]> nodeOffsets;
 };
 
 } // namespace processor
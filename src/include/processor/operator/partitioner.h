@@ -1,6 +1,7 @@
 #pragma once
 
 #include "processor/operator/sink.h"
+#include "processor/result/spill_file.h"
 #include "storage/store/chunked_node_group_collection.h"
 
 namespace kuzu {
@@ -25,6 +26,14 @@ struct PartitioningBuffer {
     void merge(std::unique_ptr<PartitioningBuffer> localPartitioningStates);
 };
 
+// Tuples of a partition that were spilled to disk. The file holds batches of tuples, each written
+// as its number of tuples followed by the values of each column.
+struct SpilledPartition {
+    std::mutex mtx;
+    std::unique_ptr<SpillFile> file;
+    uint64_t numTuples = 0;
+};
+
 // NOTE: Currently, Partitioner is tightly coupled with RelBatchInsert. We should generalize it
 // later when necessary. Here, each partition is essentially a node group.
 struct BatchInsertSharedState;
@@ -39,6 +48,11 @@ struct PartitionerSharedState {
     std::vector<common::offset_t> maxNodeOffsets;       // max node offset in each direction.
     std::vector<common::partition_idx_t> numPartitions; // num of partitions in each direction.
     std::vector<std::unique_ptr<PartitioningBuffer>> partitioningBuffers;
+    // Memory (in bytes) that partitioned tuples can take before they are spilled to disk. 0
+    // disables spilling.
+    uint64_t memoryLimit = 0;
+    // Spilled tuples of each partition in each direction. Empty unless spilling is enabled.
+    std::vector<std::vector<std::unique_ptr<SpilledPartition>>> spilledPartitions;
     common::partition_idx_t nextPartitionIdx = 0;
     // In copy rdf, we need to access num nodes before it is available in statistics.
     std::vector<std::shared_ptr<BatchInsertSharedState>> nodeBatchInsertSharedStates;
@@ -51,6 +65,16 @@ struct PartitionerSharedState {
     void resetState();
     void merge(std::vector<std::unique_ptr<PartitioningBuffer>> localPartitioningStates);
 
+    // Spills and clears the given thread-local buffers. Returns the number of tuples spilled.
+    uint64_t spill(std::vector<std::unique_ptr<PartitioningBuffer>>& localPartitioningStates,
+        main::ClientContext* context);
+    // Reads spilled tuples of a partition back into its partition buffer.
+    void loadSpilledPartition(common::vector_idx_t partitioningIdx,
+        common::partition_idx_t partitionIdx, main::ClientContext* context);
+    // Frees the memory of a partition once it has been copied to the table.
+    void releasePartition(common::vector_idx_t partitioningIdx,
+        common::partition_idx_t partitionIdx);
+
     inline const storage::ChunkedNodeGroupCollection& getPartitionBuffer(
         common::vector_idx_t partitioningIdx, common::partition_idx_t partitionIdx) const {
         KU_ASSERT(partitioningIdx < partitioningBuffers.size());
@@ -61,6 +85,9 @@ struct PartitionerSharedState {
 
 struct PartitionerLocalState {
     std::vector<std::unique_ptr<PartitioningBuffer>> partitioningBuffers;
+    // Each thread spills its buffers once they take more than an even share of the memory limit of
+    // the shared state. 0 if spilling is not enabled.
+    uint64_t memoryLimit = 0;
 
     PartitioningBuffer* getPartitioningBuffer(common::partition_idx_t partitioningIdx) {
         KU_ASSERT(partitioningIdx < partitioningBuffers.size());
@@ -102,6 +129,9 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() final;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const final;
+
     static void initializePartitioningStates(std::vector<std::unique_ptr<PartitioningInfo>>& infos,
         std::vector<std::unique_ptr<PartitioningBuffer>>& partitioningBuffers,
         std::vector<common::partition_idx_t> numPartitions);
@@ -114,6 +144,12 @@ private:
     //  generalized to resultSet later if needed.
     void copyDataToPartitions(common::partition_idx_t partitioningIdx,
         common::DataChunk chunkToCopyFrom);
+    // Estimated memory taken by the thread-local partitioning buffers.
+    uint64_t getLocalMemoryUsage() const;
+
+    std::string getSpilledTuplesMetricKey() const {
+        return "spilledTuples-" + std::to_string(id);
+    }
 
 private:
     std::vector<std::unique_ptr<PartitioningInfo>> infos;
@@ -122,6 +158,7 @@ private:
 
     // Intermediate temp value vector.
     std::unique_ptr<common::ValueVector> partitionIdxes;
+    common::NumericMetric* spilledTuples;
 };
 
 } // namespace processor
@@ -36,11 +36,15 @@ public:
     }
 
     void consume();
+    // Drains the queue of the index into its in-memory hash index and writes the hash index to
+    // disk. Blocks until no other thread is consuming the index.
+    void consumeAndMergeIndex(size_t index);
 
     common::PhysicalTypeID pkTypeID() const { return pkIndex->keyTypeID(); }
 
 private:
     void maybeConsumeIndex(size_t index);
+    void consumeIndexNoLock(size_t index);
 
     std::array<std::mutex, storage::NUM_HASH_INDEXES> mutexes;
     storage::PrimaryKeyIndex* pkIndex;
@@ -106,6 +110,9 @@ class IndexBuilderSharedState {
 public:
     explicit IndexBuilderSharedState(storage::PrimaryKeyIndex* pkIndex) : globalQueues{pkIndex} {}
     inline void consume() { globalQueues.consume(); }
+    // Writes the hash indexes built so far to disk. Threads claim one hash index at a time, so that
+    // all threads calling this write hash indexes in parallel.
+    void merge();
     inline void flush() { globalQueues.flushToDisk(); }
 
     inline void addProducer() { producers.fetch_add(1, std::memory_order_relaxed); }
@@ -117,6 +124,7 @@ private:
 
     std::atomic<size_t> producers;
     std::atomic<bool> done;
+    std::atomic<size_t> nextIndexToMerge;
 };
 
 // RAII for producer counting.
@@ -156,6 +164,8 @@ public:
     ProducerToken getProducerToken() const { return ProducerToken(sharedState); }
 
     void finishedProducing();
+    // Must be called after finishedProducing.
+    void merge() { sharedState->merge(); }
     void finalize(ExecutionContext* context);
 
 private:
@@ -88,7 +88,8 @@ public:
         std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : BatchInsert{std::move(info), std::move(sharedState), std::move(resultSetDescriptor), id,
-              paramsString} {
+              paramsString},
+          indexBuildTime{nullptr}, indexMergeTime{nullptr} {
         children.push_back(std::move(child));
     }
 
@@ -105,6 +106,9 @@ public:
 
     void finalize(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return std::make_unique<NodeBatchInsert>(info->copy(), sharedState,
             resultSetDescriptor->copy(), children[0]->clone(), id, paramsString);
@@ -136,6 +140,22 @@ private:
         common::offset_t startIndexInGroup);
 
     void copyToNodeGroup(transaction::Transaction* transaction);
+
+    std::string getIndexBuildTimeMetricKey() const {
+        return "indexBuildTime-" + std::to_string(id);
+    }
+    std::string getIndexMergeTimeMetricKey() const {
+        return "indexMergeTime-" + std::to_string(id);
+    }
+    std::string getIndexFlushTimeMetricKey() const {
+        return "indexFlushTime-" + std::to_string(id);
+    }
+
+private:
+    // Time spent by each thread draining its remaining keys into the in-memory hash indexes, and
+    // writing the hash indexes to disk.
+    common::TimeMetric* indexBuildTime;
+    common::TimeMetric* indexMergeTime;
 };
 
 } // namespace processor
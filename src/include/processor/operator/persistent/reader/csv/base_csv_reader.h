@@ -30,6 +30,11 @@ public:
     // Get the file offset of the current buffer position.
     uint64_t getFileOffset() const;
 
+    // Returns the position of the first c1, c2 or c3 in buffer[position, end), or end if there is
+    // none.
+    static uint64_t findFirstOf(const char* buffer, uint64_t position, uint64_t end, char c1,
+        char c2, char c3);
+
 protected:
     template<typename Driver>
     void addValue(Driver&, uint64_t rowNum, common::column_id_t columnIdx, std::string_view strVal,
@@ -61,9 +66,6 @@ protected:
 
     uint64_t getLineNumber();
 
-protected:
-    virtual void handleQuotedNewline() = 0;
-
 protected:
     common::CSVOption option;
 
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
 #include "base_csv_reader.h"
 #include "common/types/types.h"
 #include "function/function.h"
@@ -10,24 +15,67 @@
 namespace kuzu {
 namespace processor {
 
+//! State of the CSV parser before a character, as far as it decides whether a newline ends a row.
+enum class CSVQuoteState : uint8_t {
+    VALUE_START = 0,
+    UNQUOTED_VALUE = 1,
+    IN_QUOTES = 2,
+    // After an escape character in a quoted value.
+    ESCAPE = 3,
+    // After a quote which ends a quoted value, unless it is followed by another quote.
+    UNQUOTE = 4,
+};
+static constexpr uint8_t NUM_CSV_QUOTE_STATES = 5;
+//! The state at the end of a block for each state at its start.
+using csv_block_transitions_t = std::array<CSVQuoteState, NUM_CSV_QUOTE_STATES>;
+
+//! Quoted values may contain newlines, so the first row of a block can only be found once the
+//! quote state at the start of the block is known. Before parsing a block, each reader records
+//! the block's transitions, which only needs a cheap scan of the block. The start state of a block
+//! is then chained from the transitions of all preceding blocks, so readers wait for preceding
+//! blocks to be scanned, but not to be parsed.
+class CSVBlockStartStates {
+public:
+    CSVBlockStartStates() : startStates{CSVQuoteState::VALUE_START} {}
+
+    void setBlockTransitions(common::block_idx_t blockIdx,
+        const csv_block_transitions_t& transitions);
+    //! Waits until the transitions of all blocks before blockIdx are set.
+    CSVQuoteState getBlockStartState(common::block_idx_t blockIdx);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::optional<csv_block_transitions_t>> blockTransitions;
+    // Start states of the first blocks, computed so far.
+    std::vector<CSVQuoteState> startStates;
+};
+
 //! ParallelCSVReader is a class that reads values from a stream in parallel.
 class ParallelCSVReader final : public BaseCSVReader {
     friend class ParallelParsingDriver;
 
 public:
     ParallelCSVReader(const std::string& filePath, common::CSVOption option, uint64_t numColumns,
-        main::ClientContext* context);
+        main::ClientContext* context, CSVBlockStartStates* blockStartStates);
 
     bool hasMoreToRead() const;
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
     uint64_t continueBlock(common::DataChunk& resultChunk);
 
-protected:
-    void handleQuotedNewline() override;
-
 private:
     bool finishedBlock() const;
     void seekToBlockStart();
+    void setBlockTransitions();
+    csv_block_transitions_t computeBlockTransitions();
+
+    inline CSVQuoteState getNextQuoteState(CSVQuoteState state, char c) const {
+        return quoteStateTransitions[static_cast<uint8_t>(state)][static_cast<uint8_t>(c)];
+    }
+
+private:
+    CSVBlockStartStates* blockStartStates;
+    std::array<std::array<CSVQuoteState, 256>, NUM_CSV_QUOTE_STATES> quoteStateTransitions;
 };
 
 struct ParallelCSVLocalState final : public function::TableFuncLocalState {
@@ -44,6 +92,8 @@ struct ParallelCSVScanSharedState final : public function::ScanFileSharedState {
     void setFileComplete(uint64_t completedFileIdx);
 
     uint64_t numColumns;
+    // One per file.
+    std::vector<std::unique_ptr<CSVBlockStartStates>> blockStartStates;
     uint64_t numBlocksReadByFiles = 0;
     common::CSVReaderConfig csvReaderConfig;
 };
@@ -17,9 +17,6 @@ public:
     //! Sniffs CSV dialect and determines skip rows, header row, column types and column names
     std::vector<std::pair<std::string, common::LogicalType>> sniffCSV();
     uint64_t parseBlock(common::block_idx_t blockIdx, common::DataChunk& resultChunk) override;
-
-protected:
-    void handleQuotedNewline() override {}
 };
 
 struct SerialCSVScanSharedState final : public function::ScanFileSharedState {
@@ -8,6 +8,7 @@
 #include "function/table/scan_functions.h"
 #include "parquet/parquet_types.h"
 #include "resizable_buffer.h"
+#include "storage/predicate/column_predicate.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
 namespace kuzu {
@@ -55,6 +56,11 @@ public:
 
     inline kuzu_parquet::format::FileMetaData* getMetadata() const { return metadata.get(); }
 
+    // Returns true if the min/max statistics of the row group show that no row satisfies all
+    // predicates of each column.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<std::vector<storage::ColumnPredicate>>& columnPredicates) const;
+
 private:
     inline std::unique_ptr<kuzu_apache::thrift::protocol::TProtocol> createThriftProtocol(
         common::FileInfo* fileInfo_, bool prefetch_mode) {
@@ -90,10 +96,12 @@ private:
 };
 
 struct ParquetScanSharedState final : public function::ScanFileSharedState {
-    explicit ParquetScanSharedState(const common::ReaderConfig readerConfig, uint64_t numRows,
-        main::ClientContext* context);
+    ParquetScanSharedState(const common::ReaderConfig readerConfig, uint64_t numRows,
+        main::ClientContext* context,
+        std::vector<std::vector<storage::ColumnPredicate>> columnPredicates);
 
     std::vector<std::unique_ptr<ParquetReader>> readers;
+    std::vector<std::vector<storage::ColumnPredicate>> columnPredicates;
     uint64_t totalRowsGroups;
     uint64_t numBlocksReadByFiles;
 };
@@ -25,6 +25,7 @@ public:
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos);
 
     void resetState(const BaseBFSState& bfsState);
+    void resetState(const std::vector<Frontier*>& frontiers_);
 
 protected:
     virtual void initScanFromDstOffset() = 0;
@@ -110,12 +111,19 @@ private:
 class DstNodeWithMultiplicityScanner : public BaseFrontierScanner {
 public:
     DstNodeWithMultiplicityScanner(TargetDstNodes* targetDstNodes, size_t k)
-        : BaseFrontierScanner{targetDstNodes, k} {}
+        : BaseFrontierScanner{targetDstNodes, k}, multiplicity{0} {}
 
 private:
-    inline void initScanFromDstOffset() final {}
+    // Frontiers may be shared with other threads (see MultiSourceBFSSharedState), so the remaining
+    // multiplicity is kept in the scanner.
+    inline void initScanFromDstOffset() final {
+        multiplicity = frontiers[k]->getMultiplicity(currentDstNodeID);
+    }
     void scanFromDstOffset(RecursiveJoinVectors* vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos) final;
+
+private:
+    uint64_t multiplicity;
 };
 
 /*
@@ -144,6 +152,13 @@ struct FrontiersScanner {
             scanner->resetState(bfsState);
         }
     }
+
+    inline void resetState(const std::vector<Frontier*>& frontiers) {
+        cursor = 0;
+        for (auto& scanner : scanners) {
+            scanner->resetState(frontiers);
+        }
+    }
 };
 
 } // namespace processor
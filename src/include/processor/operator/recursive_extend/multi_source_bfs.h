@@ -0,0 +1,150 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include "bfs_state.h"
+#include "common/enums/query_rel_type.h"
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Number of sources computed together by a multi-source BFS, i.e. one bit per source in a lane
+// mask.
+static constexpr uint32_t MULTI_SOURCE_BFS_NUM_LANES = 64;
+
+using lane_mask_t = uint64_t;
+
+/*
+ * A MultiSourceFrontier stores the nodes of one level for a batch of sources. Each node keeps a
+ * mask of the sources (lanes) that reached it and, for variable length joins, the number of walks
+ * from each of these sources.
+ */
+struct MultiSourceFrontier {
+    std::vector<common::nodeID_t> nodeIDs;
+    common::node_id_map_t<lane_mask_t> laneMasks;
+    common::node_id_map_t<std::vector<uint64_t>> laneMultiplicities;
+
+    void resetState() {
+        nodeIDs.clear();
+        laneMasks.clear();
+        laneMultiplicities.clear();
+    }
+};
+
+// Frontiers of each source in a batch. Only target dst nodes reached with at least lowerBound
+// extensions are kept, which is all that DstNodeWithMultiplicityScanner reads.
+struct MultiSourceBFSResult {
+    std::vector<std::vector<std::unique_ptr<Frontier>>> laneFrontiers;
+
+    std::vector<Frontier*> getFrontiers(uint32_t lane) const;
+};
+
+/*
+ * MultiSourceBFSState computes the BFS of up to 64 sources (MS-BFS) at the same time. Nodes of a
+ * frontier are extended once for all sources that reached them, so the adjacency list of a node is
+ * scanned once per level instead of once per source. Only shortest path and variable length joins
+ * that do not track paths are supported.
+ */
+class MultiSourceBFSState {
+public:
+    MultiSourceBFSState(common::QueryRelType queryRelType, uint8_t lowerBound, uint8_t upperBound,
+        TargetDstNodes* targetDstNodes)
+        : trackMultiplicity{queryRelType == common::QueryRelType::VARIABLE_LENGTH},
+          lowerBound{lowerBound}, upperBound{upperBound}, targetDstNodes{targetDstNodes},
+          activeLanes{0}, currentLevel{0}, nextNodeIdxToExtend{0}, boundLanes{0},
+          boundMultiplicities{nullptr} {}
+
+    void resetState(const std::vector<common::nodeID_t>& srcNodeIDs);
+
+    bool isComplete() const {
+        return currentFrontier.nodeIDs.empty() || currentLevel == upperBound || activeLanes == 0;
+    }
+
+    // Get next node to extend from current level. Nodes that are only reached by sources that
+    // already finished are skipped.
+    common::nodeID_t getNextNodeID();
+
+    void markVisited(common::nodeID_t nbrNodeID);
+
+    void finalizeCurrentLevel();
+
+    std::unique_ptr<MultiSourceBFSResult> getResult();
+
+private:
+    void markSrc(common::nodeID_t nodeID, uint32_t lane);
+    void markTargetVisited(common::nodeID_t nodeID, lane_mask_t lanes);
+    void addFrontierToResult(const MultiSourceFrontier& frontier, uint8_t level);
+
+private:
+    // Static information
+    bool trackMultiplicity;
+    uint8_t lowerBound;
+    uint8_t upperBound;
+    TargetDstNodes* targetDstNodes;
+    // Lanes whose BFS is not complete yet.
+    lane_mask_t activeLanes;
+    // Level state
+    uint8_t currentLevel;
+    uint64_t nextNodeIdxToExtend;
+    lane_mask_t boundLanes;
+    std::vector<uint64_t>* boundMultiplicities;
+    MultiSourceFrontier currentFrontier;
+    MultiSourceFrontier nextFrontier;
+    // Shortest path only. Lanes that have visited a node and number of target dst nodes visited by
+    // each lane.
+    common::node_id_map_t<lane_mask_t> visited;
+    std::vector<uint64_t> numVisitedDstNodes;
+
+    std::unique_ptr<MultiSourceBFSResult> result;
+};
+
+/*
+ * Sources of a recursive join are accumulated before the join starts, so they are known in
+ * advance. MultiSourceBFSSharedState reads them from the accumulated table and groups them into
+ * batches of 64 distinct sources in scan order. The first thread that needs a source computes the
+ * BFS of its whole batch. Each batch counts the tuples of its sources, including repeated ones, so
+ * its result is only dropped after the last tuple that needs it has been consumed.
+ */
+class MultiSourceBFSSharedState {
+public:
+    using compute_func_t = std::function<std::unique_ptr<MultiSourceBFSResult>(
+        const std::vector<common::nodeID_t>&)>;
+
+    MultiSourceBFSSharedState(std::shared_ptr<FactorizedTable> srcTable, ft_col_idx_t srcColIdx,
+        std::unordered_set<common::table_id_t> srcTableIDs)
+        : srcTable{std::move(srcTable)}, srcColIdx{srcColIdx},
+          srcTableIDs{std::move(srcTableIDs)}, initialized{false} {}
+
+    // Returns the result of the batch of the given source, or nullptr if the source does not
+    // belong to any batch.
+    std::shared_ptr<MultiSourceBFSResult> getResult(common::nodeID_t srcNodeID,
+        const compute_func_t& computeFunc, storage::MemoryManager* memoryManager, uint32_t& lane);
+
+private:
+    struct Batch {
+        std::vector<common::nodeID_t> srcNodeIDs;
+        std::shared_ptr<MultiSourceBFSResult> result = nullptr;
+        bool computing = false;
+        uint64_t numPendingTuples = 0;
+    };
+
+    void initNoLock(storage::MemoryManager* memoryManager);
+
+private:
+    std::shared_ptr<FactorizedTable> srcTable;
+    ft_col_idx_t srcColIdx;
+    std::unordered_set<common::table_id_t> srcTableIDs;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool initialized;
+    // Source to its batch index and lane in the batch.
+    common::node_id_map_t<std::pair<uint64_t, uint32_t>> srcToBatchAndLane;
+    std::vector<Batch> batches;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -4,6 +4,7 @@
 #include "common/enums/extend_direction.h"
 #include "common/enums/query_rel_type.h"
 #include "frontier_scanner.h"
+#include "multi_source_bfs.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/mask.h"
 #include "processor/operator/physical_operator.h"
@@ -15,9 +16,13 @@ class LookupNodeTable;
 
 struct RecursiveJoinSharedState {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
+    // Not null if BFS of the accumulated sources can be computed in batches.
+    std::unique_ptr<MultiSourceBFSSharedState> multiSourceBFSSharedState;
 
-    explicit RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks)
-        : semiMasks{std::move(semiMasks)} {}
+    explicit RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks,
+        std::unique_ptr<MultiSourceBFSSharedState> multiSourceBFSSharedState = nullptr)
+        : semiMasks{std::move(semiMasks)},
+          multiSourceBFSSharedState{std::move(multiSourceBFSSharedState)} {}
 };
 
 struct RecursiveJoinDataInfo {
@@ -133,6 +138,14 @@ private:
 
     void updateVisitedNodes(common::nodeID_t boundNodeID);
 
+    // Scan the BFS result of the given src node from its multi-source BFS batch. Return false if
+    // the src node is not part of any batch.
+    bool scanMultiSourceBFSResult(common::nodeID_t srcNodeID, ExecutionContext* context);
+
+    // Compute BFS for a batch of src nodes together.
+    std::unique_ptr<MultiSourceBFSResult> computeMultiSourceBFS(
+        const std::vector<common::nodeID_t>& srcNodeIDs, ExecutionContext* context);
+
 private:
     RecursiveJoinInfo info;
     std::shared_ptr<RecursiveJoinSharedState> sharedState;
@@ -144,6 +157,9 @@ private:
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
+    std::unique_ptr<MultiSourceBFSState> multiSourceBFSState;
+    // Keeps the frontiers being scanned alive.
+    std::shared_ptr<MultiSourceBFSResult> multiSourceBFSResult;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
 };
@@ -3,6 +3,7 @@
 #include "common/enums/join_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_chunk_queue.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,15 @@ public:
 
     inline std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    // A streaming query pushes its result into the queue chunk by chunk instead of merging it into
+    // the table.
+    void setChunkQueue(std::shared_ptr<ResultChunkQueue> queue) { chunkQueue = std::move(queue); }
+    ResultChunkQueue* getChunkQueue() const { return chunkQueue.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    std::shared_ptr<ResultChunkQueue> chunkQueue;
 };
 
 struct ResultCollectorInfo {
@@ -60,6 +67,11 @@ public:
         return sharedState->getTable();
     }
 
+    void setResultChunkQueue(std::shared_ptr<ResultChunkQueue> queue) {
+        KU_ASSERT(info->accumulateType == common::AccumulateType::REGULAR);
+        sharedState->setChunkQueue(std::move(queue));
+    }
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info->copy(), sharedState,
             children[0]->clone(), id, paramsString);
@@ -68,6 +80,8 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
+    void pushLocalTableToQueue(ExecutionContext* context);
+
 private:
     std::unique_ptr<ResultCollectorInfo> info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "processor/operator/scan/scan_table.h"
+#include "storage/predicate/column_predicate.h"
 #include "storage/store/node_table.h"
 
 namespace kuzu {
@@ -28,16 +29,25 @@ private:
 struct ScanNodeTableInfo {
     storage::NodeTable* table;
     std::vector<common::column_id_t> columnIDs;
+    // Predicates of each column in columnIDs used to skip node groups.
+    std::vector<std::vector<storage::ColumnPredicate>> columnPredicates;
 
     std::unique_ptr<storage::NodeTableScanState> localScanState;
 
-    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs)
-        : table{table}, columnIDs{std::move(columnIDs)} {}
+    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs,
+        std::vector<std::vector<storage::ColumnPredicate>> columnPredicates = {})
+        : table{table}, columnIDs{std::move(columnIDs)},
+          columnPredicates{std::move(columnPredicates)} {}
     EXPLICIT_COPY_DEFAULT_MOVE(ScanNodeTableInfo);
 
+    // Returns true if statistics of the node group to scan show that no node in it satisfies the
+    // column predicates.
+    bool canSkipNodeGroup() const;
+
 private:
     ScanNodeTableInfo(const ScanNodeTableInfo& other)
-        : table{other.table}, columnIDs{other.columnIDs} {}
+        : table{other.table}, columnIDs{other.columnIDs},
+          columnPredicates{other.columnPredicates} {}
 };
 
 class ScanNodeTable final : public ScanTable {
@@ -48,7 +58,8 @@ public:
         std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates, uint32_t id,
         const std::string& paramsString)
         : ScanTable{type_, std::move(info), id, paramsString}, currentTableIdx{0},
-          nodeInfos{std::move(nodeInfos)}, sharedStates{std::move(sharedStates)} {
+          nodeInfos{std::move(nodeInfos)}, sharedStates{std::move(sharedStates)},
+          numSkippedNodeGroups{nullptr} {
         KU_ASSERT(this->nodeInfos.size() == this->sharedStates.size());
     }
 
@@ -65,14 +76,22 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 private:
     void initGlobalStateInternal(ExecutionContext* context) override;
 
+    std::string getSkippedNodeGroupsMetricKey() const {
+        return "skippedNodeGroups-" + std::to_string(id);
+    }
+
 private:
     common::vector_idx_t currentTableIdx;
     // TODO(Guodong): Refactor following three fields into a vector of structs.
     std::vector<ScanNodeTableInfo> nodeInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
+    common::NumericMetric* numSkippedNodeGroups;
 };
 
 } // namespace processor
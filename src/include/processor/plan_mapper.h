@@ -6,6 +6,7 @@
 #include "planner/operator/logical_plan.h"
 #include "processor/operator/result_collector.h"
 #include "processor/physical_plan.h"
+#include "storage/predicate/column_predicate.h"
 
 namespace kuzu {
 namespace main {
@@ -20,6 +21,7 @@ struct BoundSetPropertyInfo;
 namespace planner {
 struct LogicalInsertInfo;
 class LogicalCopyFrom;
+class LogicalRecursiveExtend;
 } // namespace planner
 
 namespace processor {
@@ -36,6 +38,7 @@ struct ExtraNodeDeleteInfo;
 
 struct BatchInsertSharedState;
 struct PartitionerSharedState;
+class MultiSourceBFSSharedState;
 
 class PlanMapper {
 public:
@@ -115,6 +118,9 @@ private:
         std::shared_ptr<BatchInsertSharedState> sharedState, planner::LogicalCopyFrom* copyFrom,
         common::RelDataDirection direction, std::vector<common::LogicalType> columnTypes);
 
+    std::unique_ptr<MultiSourceBFSSharedState> createMultiSourceBFSSharedState(
+        const planner::LogicalRecursiveExtend& extend);
+
     std::unique_ptr<ResultCollector> createResultCollector(common::AccumulateType accumulateType,
         const binder::expression_vector& expressions, planner::Schema* schema,
         std::unique_ptr<PhysicalOperator> prevOperator);
@@ -204,6 +210,11 @@ private:
         return DataPos(schema.getExpressionPos(expression));
     }
 
+    // Returns the predicates on each column that can be checked against column statistics. Each
+    // predicate compares one of the columns with a constant.
+    static std::vector<std::vector<storage::ColumnPredicate>> getColumnPredicates(
+        const binder::expression_vector& columns, const binder::expression_vector& predicates);
+
 public:
     ExpressionMapper expressionMapper;
     main::ClientContext* clientContext;
@@ -15,6 +15,8 @@ public:
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
 private:
+    static bool canRunPipelinesConcurrently(PhysicalOperator* op);
+
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
     void initTask(common::Task* task);
@@ -132,6 +132,8 @@ public:
 
     uint64_t getNumTuples() const { return numTuples; }
     uint64_t getTotalNumFlatTuples() const;
+    // Size of all blocks allocated by the table, including overflow data.
+    uint64_t getMemoryUsage() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
 
     const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
@@ -244,6 +246,11 @@ public:
 
     void resetState();
 
+    // A table without unflat columns has exactly one flat tuple per tuple, so it can also be read
+    // tuple by tuple, e.g. column-wise. These get and move the position of the next tuple to read.
+    ft_tuple_idx_t getNextTupleIdxOfFlatTable() const;
+    void skipTuplesOfFlatTable(uint64_t numTuplesToSkip);
+
 private:
     // The dataChunkPos may be not consecutive, which means some entries in the
     // flatTuplePositionsInDataChunk is invalid. We put pair(UINT64_MAX, UINT64_MAX) in the
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+#include "processor/result/factorized_table.h"
+#include "processor/result/spill_file.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * ResultChunkQueue hands the result of a streaming query from its ResultCollector to the
+ * QueryResult reading it. The result is split into chunks, each a factorized table of up to
+ * CHUNK_NUM_TUPLES tuples. The queue holds at most capacity chunks in memory. Chunks pushed into a
+ * full queue are spilled to disk and read back in order when the reader gets to them, so pushing
+ * never waits for the reader and a query runs to completion however slowly its result is read.
+ */
+class ResultChunkQueue {
+    // Spilled chunks are appended to the last segment until the reader starts reading it, after
+    // which a new segment is started.
+    struct SpilledSegment {
+        std::unique_ptr<SpillFile> file;
+        std::unique_ptr<common::Deserializer> deserializer;
+        uint64_t numChunks = 0;
+    };
+
+public:
+    static constexpr uint64_t CHUNK_NUM_TUPLES = common::DEFAULT_VECTOR_CAPACITY;
+    static constexpr uint64_t DEFAULT_CAPACITY = 8;
+
+    ResultChunkQueue(main::ClientContext* context, std::vector<common::LogicalType> columnTypes,
+        uint64_t capacity = DEFAULT_CAPACITY);
+
+    // Returns false, and drops the chunk, if the reader closed the queue.
+    bool push(std::unique_ptr<FactorizedTable> chunk);
+
+    // Waits until a chunk is available or the query completes. Throws the error of the query if it
+    // failed.
+    bool hasNextChunk();
+    // Pops the next chunk. Must only be called after hasNextChunk() returns true.
+    std::unique_ptr<FactorizedTable> popChunk();
+
+    // Called once the query completes, with the error message if it failed. Chunks that are not
+    // read yet are dropped if the query failed.
+    void finish(std::optional<std::string> errMsg = std::nullopt);
+    // Called by the reader when it stops reading. Chunks pushed afterwards are dropped.
+    void close();
+
+    bool isFinished();
+    std::optional<std::string> getErrorMessage();
+    // Number of flat tuples pushed into the queue so far.
+    uint64_t getNumTuples();
+    // Number of chunks spilled to disk so far.
+    uint64_t getNumSpilledChunks();
+    // Time in milliseconds from the creation of the queue until the first chunk is pushed, or until
+    // the query completes if the result is empty. Returns std::nullopt if neither happened yet.
+    std::optional<double> getTimeToFirstChunk();
+    // Time in milliseconds from the creation of the queue until the query completes.
+    std::optional<double> getExecutionTime();
+
+private:
+    void spillChunk(const FactorizedTable& chunk);
+    std::unique_ptr<FactorizedTable> readSpilledChunk(common::Deserializer& deserializer) const;
+    void clearNoLock();
+    double getElapsedTimeMSNoLock() const;
+
+private:
+    main::ClientContext* context;
+    std::vector<common::LogicalType> columnTypes;
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t capacity;
+    // Chunks in the order they are pushed. Spilled chunks are held as nullptr.
+    std::deque<std::unique_ptr<FactorizedTable>> chunks;
+    uint64_t numChunksInMemory;
+    std::deque<std::shared_ptr<SpilledSegment>> spilledSegments;
+    uint64_t numSpilledChunks;
+    bool finished;
+    bool closed;
+    std::optional<std::string> errMsg;
+    uint64_t numTuples;
+    std::chrono::steady_clock::time_point startTime;
+    std::optional<double> timeToFirstChunk;
+    std::optional<double> executionTime;
+};
+
+} // namespace processor
+} // namespace kuzu
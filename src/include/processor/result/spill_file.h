@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+
+#include "common/copy_constructors.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace processor {
+
+// Temporary file under the database directory that operators write intermediate results to when
+// they run short of memory. A spill file is written sequentially, by one thread at a time, then read
+// back from the beginning, and is removed when destructed.
+class SpillFile {
+public:
+    explicit SpillFile(main::ClientContext* context);
+    DELETE_COPY_AND_MOVE(SpillFile);
+    ~SpillFile();
+
+    common::Serializer& getSerializer() { return *serializer; }
+
+    // Number of bytes written so far.
+    uint64_t getSize() const { return writer->getFileSize(); }
+
+    // Flushes written data and returns a deserializer reading the file from the beginning. Nothing
+    // can be written to the file afterwards.
+    std::unique_ptr<common::Deserializer> getDeserializer();
+
+private:
+    main::ClientContext* context;
+    std::string path;
+    std::shared_ptr<common::BufferedFileWriter> writer;
+    std::unique_ptr<common::Serializer> serializer;
+
+    static std::atomic<uint64_t> nextFileIdx;
+};
+
+} // namespace processor
+} // namespace kuzu
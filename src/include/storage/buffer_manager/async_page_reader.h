@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kuzu {
+namespace storage {
+
+// AsyncPageReader runs the page reads submitted by `BufferManager::prefetchPageRangeAsync()` on a
+// small pool of background threads, so that the thread scanning a column keeps processing pages
+// that are already cached while the pages it needs next are read. The threads are started on the
+// first submission, and the reads that are still queued are completed before they are stopped.
+// `waitForPendingReads()` lets the callers that rewrite pages in place, such as checkpointing and
+// rolling back the WAL, wait until no read fills a frame in the background anymore.
+class AsyncPageReader {
+public:
+    explicit AsyncPageReader(uint64_t numThreads);
+    ~AsyncPageReader();
+
+    void submit(std::function<void()> read);
+    // Blocks until all reads submitted so far are completed.
+    void waitForPendingReads();
+
+private:
+    void startThreadsNoLock();
+    void runReadLoop();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::condition_variable cvForPendingReads;
+    uint64_t numThreads;
+    std::deque<std::function<void()>> reads;
+    // Number of reads submitted, including the running ones, that are not completed yet.
+    uint64_t numPendingReads;
+    bool stopped;
+    std::vector<std::thread> threads;
+};
+
+} // namespace storage
+} // namespace kuzu
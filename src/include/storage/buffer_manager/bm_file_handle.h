@@ -217,6 +217,9 @@ private:
     // `WALPageIdxGroup` records the WAL page idx for each page in the page group.
     // Accesses to this map is synchronized by `fhSharedMutex`.
     std::unordered_map<common::page_group_idx_t, std::unique_ptr<WALPageIdxGroup>> walPageIdxGroups;
+    // Number of reads submitted by `BufferManager::prefetchPageRangeAsync()` that are not completed
+    // yet. The file handle waits for them before it is destroyed.
+    std::atomic<uint64_t> numPendingAsyncReads;
 };
 } // namespace storage
 } // namespace kuzu
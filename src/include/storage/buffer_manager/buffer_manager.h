@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <thread>
 #include <vector>
 
+#include "storage/buffer_manager/async_page_reader.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/buffer_manager/locked_queue.h"
 
@@ -31,6 +35,9 @@ struct EvictionCandidate {
     PageState* pageState = nullptr;
     // The version of the corresponding page at the time the candidate is enqueued.
     uint64_t pageVersion = -1u;
+    // Only used by the SCAN_RESISTANT eviction policy. See `EvictionQueue` for more details.
+    bool inProbation = false;
+    bool accessedInProbation = false;
 
     inline bool operator==(const EvictionCandidate& other) const {
         return fileHandle == other.fileHandle && pageIdx == other.pageIdx &&
@@ -38,31 +45,95 @@ struct EvictionCandidate {
     }
 };
 
+enum class EvictionPolicy : uint8_t {
+    // A single FIFO queue, in which pages that were read since they were enqueued get a second
+    // chance.
+    FIFO = 0,
+    // Pages read from disk first go to a probation queue, and only move to the main queue if they
+    // are accessed again. See `EvictionQueue` for more details.
+    SCAN_RESISTANT = 1,
+};
+
+// The SCAN_RESISTANT policy is inspired by 2Q ("2Q: A Low Overhead High Performance Buffer
+// Management Replacement Algorithm", VLDB'94). A page that was just read from disk is enqueued into
+// the probation queue, so that a large scan only recycles the frames of the probation queue instead
+// of evicting the pages other queries keep accessing, which live in the main queue.
+// A scan reads a page several times right after loading it, so being accessed once in the probation
+// queue is not enough to be moved to the main queue. Instead, an accessed probation candidate first
+// gets a second chance in the probation queue, and is only moved to the main queue if it is
+// accessed again before it reaches the head of the probation queue a second time. Pages that are
+// pinned and unpinned again while cached go to the main queue directly.
+// Candidates are dequeued from the probation queue as long as it holds at least
+// SCAN_RESISTANT_MIN_PROBATION_RATIO of all candidates, so that the main queue can still be
+// recycled when the working set changes.
 class EvictionQueue {
 public:
-    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
+    explicit EvictionQueue(EvictionPolicy policy = EvictionPolicy::FIFO);
 
-    inline void enqueue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(candidate);
-    }
-    inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
-        uint64_t pageVersion) {
+    // Enqueues the candidate of a page that was just unpinned.
+    void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
+        uint64_t pageVersion);
+    // Re-enqueues a candidate that was optimistically read since it was enqueued.
+    inline void enqueueSecondChance(EvictionCandidate& candidate) {
         std::shared_lock sLck{mtx};
-        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
-    }
-    inline bool dequeue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        return queue->try_dequeue(candidate);
+        enqueueSecondChanceNoLock(candidate);
     }
+    bool dequeue(EvictionCandidate& candidate);
 
     void removeNonEvictableCandidates();
 
     void removeCandidatesForFile(BMFileHandle& fileHandle);
 
+    EvictionPolicy getPolicy() const { return policy; }
+
+private:
+    void enqueueSecondChanceNoLock(EvictionCandidate& candidate);
+    bool shouldDequeueFromProbationQueue();
+    void removeNonEvictableCandidates(LockedQueue<EvictionCandidate>& queueToPurge);
+    static void removeCandidatesForFile(LockedQueue<EvictionCandidate>& queueToPurge,
+        BMFileHandle& fileHandle);
+
 private:
     std::shared_mutex mtx;
+    EvictionPolicy policy;
     std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
+    // Only used by the SCAN_RESISTANT policy.
+    std::unique_ptr<LockedQueue<EvictionCandidate>> probationQueue;
+};
+
+// Counter updated by many threads on hot paths, such as the page access counter updated by every
+// pin. Each thread adds to one of NUM_SLOTS slots, picked by hashing its id, and each slot has a
+// cache line of its own, so threads rarely contend on a slot and never invalidate the cache lines of
+// neighbouring state, e.g. `BufferManager::usedMemory`. Reading sums up the slots.
+class ShardedCounter {
+    static constexpr uint64_t NUM_SLOTS = 16;
+    static constexpr uint64_t CACHE_LINE_SIZE = 64;
+
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        std::atomic<uint64_t> value{0};
+    };
+
+public:
+    inline void add(uint64_t value) {
+        slots[getSlotIdx()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+    uint64_t load() const {
+        uint64_t sum = 0;
+        for (auto& slot : slots) {
+            sum += slot.value.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+private:
+    static inline uint64_t getSlotIdx() {
+        static thread_local const uint64_t slotIdx =
+            std::hash<std::thread::id>{}(std::this_thread::get_id()) % NUM_SLOTS;
+        return slotIdx;
+    }
+
+private:
+    std::array<Slot, NUM_SLOTS> slots;
 };
 
 /**
@@ -164,7 +235,10 @@ class BufferManager {
 public:
     enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
 
-    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize);
+    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize,
+        EvictionPolicy evictionPolicy = EvictionPolicy::FIFO,
+        uint64_t readAheadNumPages = common::BufferPoolConstants::DEFAULT_READ_AHEAD_NUM_PAGES,
+        bool asyncReadAhead = false);
     ~BufferManager() = default;
 
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
@@ -173,6 +247,18 @@ public:
         const std::function<void(uint8_t*)>& func);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Loads the consecutive pages starting at `startPageIdx` into their frames with a single read,
+    // leaving them unpinned. Stops at the first page that is already cached or pinned, at the end
+    // of the page group or when no more memory can be claimed, so fewer pages may be loaded.
+    void prefetchPageRange(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
+    // Same as `prefetchPageRange()`, but the pages are read by a background thread. The pages stay
+    // LOCKED until they are read, so that other threads accessing them wait for the read.
+    void prefetchPageRangeAsync(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
+    // Blocks until the reads submitted by `prefetchPageRangeAsync()` are completed. Must be called
+    // before pages are replaced in their frames without being locked, as WAL replay does.
+    void waitForAsyncReads() { asyncPageReader->waitForPendingReads(); }
 
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
@@ -191,13 +277,36 @@ public:
     inline common::frame_group_idx_t addNewFrameGroup(common::PageSizeClass pageSizeClass) {
         return vmRegions[pageSizeClass]->addNewFrameGroup();
     }
-    inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
+    inline void clearEvictionQueue() {
+        evictionQueue = std::make_unique<EvictionQueue>(evictionQueue->getPolicy());
+    }
+
+    uint64_t getBufferPoolSize() const { return bufferPoolSize.load(); }
+    uint64_t getReadAheadNumPages() const { return readAheadNumPages; }
+    bool isAsyncReadAheadEnabled() const { return asyncReadAhead; }
+
+    EvictionPolicy getEvictionPolicy() const { return evictionQueue->getPolicy(); }
+    // Number of accesses to pages of database files through `pin()` and `optimisticRead()`.
+    uint64_t getNumPageAccesses() const { return numPageAccesses.load(); }
+    // Number of pages of database files read from disk, including the pages read ahead.
+    uint64_t getNumPageReads() const { return numPageReads.load(); }
+    // Number of the pages above read by the background threads of `prefetchPageRangeAsync()`.
+    uint64_t getNumAsyncPageReads() const { return numAsyncPageReads.load(); }
+    uint64_t getNumEvictions() const { return numEvictions.load(); }
 
 private:
     static void verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize);
 
     bool claimAFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    // Reserves `sizeToClaim` bytes of the buffer pool, evicting pages if necessary. Returns false,
+    // without reserving anything, if not enough pages can be evicted.
+    bool reserveMemory(uint64_t sizeToClaim);
+    // Locks the pages to prefetch and claims their frames. Returns the end of the locked range.
+    common::page_idx_t lockPagesToPrefetch(BMFileHandle& fileHandle,
+        common::page_idx_t startPageIdx, common::page_idx_t numPages);
+    void readPrefetchedPages(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t endPageIdx);
     // Return number of bytes freed.
     uint64_t tryEvictPage(EvictionCandidate& candidate);
 
@@ -210,6 +319,17 @@ private:
     void addToEvictionQueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx,
         PageState* pageState);
 
+    inline void countPageAccess(const BMFileHandle& fileHandle) {
+        if (!fileHandle.isNewTmpFile()) {
+            numPageAccesses.add(1);
+        }
+    }
+    inline void countPageReads(const BMFileHandle& fileHandle, uint64_t numPages) {
+        if (!fileHandle.isNewTmpFile()) {
+            numPageReads.add(numPages);
+        }
+    }
+
     inline uint64_t reserveUsedMemory(uint64_t size) { return usedMemory.fetch_add(size); }
     inline uint64_t freeUsedMemory(uint64_t size) {
         KU_ASSERT(usedMemory.load() >= size);
@@ -227,10 +347,17 @@ private:
     std::atomic<uint64_t> usedMemory;
     std::atomic<uint64_t> bufferPoolSize;
     std::atomic<uint64_t> numEvictionQueueInsertions;
+    const uint64_t readAheadNumPages;
+    const bool asyncReadAhead;
+    ShardedCounter numPageAccesses;
+    ShardedCounter numPageReads;
+    ShardedCounter numAsyncPageReads;
+    ShardedCounter numEvictions;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
     std::unique_ptr<EvictionQueue> evictionQueue;
+    std::unique_ptr<AsyncPageReader> asyncPageReader;
 };
 
 } // namespace storage
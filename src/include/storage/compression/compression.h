@@ -104,6 +104,7 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    ALP = 4,
 };
 
 // Data statistics used for determining how to handle compressed data
@@ -114,11 +115,16 @@ struct CompressionMetadata {
     StorageValue min;
     StorageValue max;
     CompressionType compression;
+    // Decimal exponent of ALP compressed floating point values. Unused by other compression types.
+    uint8_t exponent;
 
-    CompressionMetadata(StorageValue min, StorageValue max, CompressionType compression)
-        : min(min), max(max), compression(compression) {}
+    CompressionMetadata(StorageValue min, StorageValue max, CompressionType compression,
+        uint8_t exponent = 0)
+        : min(min), max(max), compression(compression), exponent(exponent) {}
     inline bool isConstant() const { return compression == CompressionType::CONSTANT; }
 
+    bool operator==(const CompressionMetadata&) const = default;
+
     // Returns the number of values which will be stored in the given data size
     // This must be consistent with the compression implementation for the given size
     uint64_t numValues(uint64_t dataSize, const common::LogicalType& dataType) const;
@@ -356,6 +362,65 @@ public:
     }
 };
 
+template<typename T>
+concept FloatCompressionType = (std::same_as<T, double> || std::same_as<T, float>);
+
+// ALP-style (Adaptive Lossless floating-Point) compression. Floating point columns often hold
+// decimals with few significant digits, e.g. prices or measurements. Each value v is encoded as the
+// integer round(v * 10^e), using a single exponent e per column chunk, and the integers are stored
+// with IntegerBitpacking. A chunk is only compressed if every value decodes back to exactly the
+// same bits and the bitpacked integers are narrower than the floating point values.
+template<FloatCompressionType T>
+class FloatCompression : public CompressionAlg {
+    using EncodedType = std::conditional_t<std::same_as<T, double>, int64_t, int32_t>;
+    // Encoded values are kept below 2^53 for doubles (exactly representable) and 2^31 for floats.
+    static constexpr double MAX_ENCODED_VALUE =
+        std::same_as<T, double> ? 9007199254740992.0 : 2147483647.0;
+    static constexpr uint8_t MAX_EXPONENT = std::same_as<T, double> ? 18 : 9;
+
+public:
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    // Returns nullopt if the values can't be encoded losslessly or compression doesn't save space
+    static std::optional<CompressionMetadata> analyze(const T* values, uint64_t numValues,
+        StorageValue min, StorageValue max);
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    static inline uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+        return IntegerBitpacking<EncodedType>::numValues(dataSize, getEncodedMetadata(metadata));
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    // Decodes in place, since encoded values have the same size as T
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    static bool canUpdateInPlace(T value, const CompressionMetadata& metadata);
+
+    static uint8_t getBitWidth(const CompressionMetadata& metadata) {
+        return IntegerBitpacking<EncodedType>::getPackingInfo(getEncodedMetadata(metadata))
+            .bitWidth;
+    }
+
+    CompressionType getCompressionType() const override { return CompressionType::ALP; }
+
+private:
+    // Metadata of the bitpacked integers, i.e. the encoded minimum and maximum.
+    static CompressionMetadata getEncodedMetadata(const CompressionMetadata& metadata);
+
+    static bool tryEncode(T value, uint8_t exponent, EncodedType& result);
+    static EncodedType encode(T value, uint8_t exponent);
+    static T decode(EncodedType value, uint8_t exponent);
+};
+
 class CompressedFunctor {
 public:
     CompressedFunctor(const CompressedFunctor&) = default;
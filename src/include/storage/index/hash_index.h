@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string_view>
 
 #include "common/cast.h"
@@ -40,6 +41,7 @@ public:
     virtual void checkpointInMemory() = 0;
     virtual void rollbackInMemory() = 0;
     virtual void bulkReserve(uint64_t numValuesToAppend) = 0;
+    virtual void mergeLocalStorage() = 0;
 };
 
 // HashIndex is the entrance to handle all updates and lookups into the index after building from
@@ -77,6 +79,18 @@ public:
     using Key =
         typename std::conditional<std::same_as<T, common::ku_string_t>, std::string_view, T>::type;
     bool lookupInternal(transaction::Transaction* transaction, Key key, common::offset_t& result);
+
+    // A key to look up with lookupBatch, its hash, and the position of its result.
+    struct Probe {
+        Key key;
+        common::hash_t hash;
+        uint64_t resultPos;
+    };
+    // Looks up a batch of keys and writes their values to results, or INVALID_OFFSET for keys which
+    // are not found. Persistent lookups are sorted by primary slot, so that each page of primary
+    // slots is read once per batch. The order of probes is not preserved.
+    void lookupBatch(transaction::Transaction* transaction, std::span<Probe> probes,
+        common::offset_t* results);
     void deleteInternal(Key key) const;
     bool insertInternal(Key key, common::offset_t value);
 
@@ -92,7 +106,15 @@ public:
     void rollbackInMemory() override;
     inline BMFileHandle* getFileHandle() const { return fileHandle.get(); }
 
+    // Writes local changes to the persistent index and clears them from local storage, so that a
+    // later prepareCommit only writes what was changed since. Used by COPY to write hash indexes
+    // out before the end of the transaction. Different hash indexes can be merged concurrently.
+    void mergeLocalStorage() override;
+
 private:
+    bool hasUpdates() const;
+    void applyLocalChanges();
+
     bool lookupInPersistentIndex(transaction::TransactionType trxType, Key key,
         common::offset_t& result);
     // The following two functions are only used in prepareCommit, and are not thread-safe.
@@ -219,6 +241,9 @@ private:
     std::unique_ptr<DiskArray<Slot<T>>> oSlots;
     OverflowFileHandle* overflowFileHandle;
     std::unique_ptr<HashIndexLocalStorage<T>> localStorage;
+    // Whether local changes were merged into the persistent index by mergeLocalStorage since the
+    // last checkpoint or rollback.
+    bool hasMergedLocalStorage;
     std::unique_ptr<HashIndexHeader> indexHeaderForReadTrx;
     std::unique_ptr<HashIndexHeader> indexHeaderForWriteTrx;
 };
@@ -266,6 +291,10 @@ public:
 
     bool lookup(transaction::Transaction* trx, common::ValueVector* keyVector, uint64_t vectorPos,
         common::offset_t& result);
+    // Looks up all selected keys of keyVector. The result of the i-th selected key is written to
+    // results[i], which is INVALID_OFFSET if the key is null or not found.
+    void lookupBatch(transaction::Transaction* trx, common::ValueVector* keyVector,
+        common::offset_t* results);
 
     inline bool insert(common::ku_string_t key, common::offset_t value) {
         return insert(key.getAsStringView(), value);
@@ -296,6 +325,10 @@ public:
         }
     }
 
+    // Writes the local changes of the hash index at indexPos to disk. Hash indexes at different
+    // positions can be merged concurrently.
+    void mergeLocalStorage(uint64_t indexPos) { hashIndices[indexPos]->mergeLocalStorage(); }
+
     inline void delete_(common::ku_string_t key) { return delete_(key.getAsStringView()); }
     template<common::IndexHashable T>
     inline void delete_(T key) {
@@ -317,6 +350,11 @@ public:
     static void createEmptyHashIndexFiles(common::PhysicalTypeID typeID, const std::string& fName,
         common::VirtualFileSystem* vfs, main::ClientContext* context);
 
+private:
+    template<common::IndexHashable T>
+    void lookupBatch(transaction::Transaction* trx, common::ValueVector* keyVector,
+        common::offset_t* results);
+
 private:
     // When doing batch inserts, prepareCommit needs to be run before the COPY TABLE record is
     // logged to the WAL file, since the index is reloaded when that record is replayed. However
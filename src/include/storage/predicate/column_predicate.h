@@ -0,0 +1,38 @@
+#pragma once
+
+#include <optional>
+
+#include "common/enums/expression_type.h"
+#include "common/types/value/value.h"
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Comparison between a column and a constant, i.e. column <op> value. It is checked against the
+// min/max statistics of a column chunk to tell if the chunk can be skipped.
+class ColumnPredicate {
+public:
+    ColumnPredicate(common::ExpressionType expressionType, StorageValue value)
+        : expressionType{expressionType}, value{value} {}
+
+    // Returns nullopt if the comparison cannot be checked against column chunk statistics.
+    static std::optional<ColumnPredicate> tryCreate(common::ExpressionType expressionType,
+        const common::Value& value);
+
+    // Returns true if no value within [metadata.min, metadata.max] satisfies the predicate.
+    bool canSkipChunk(const CompressionMetadata& metadata,
+        common::PhysicalTypeID physicalType) const {
+        return canSkip(metadata.min, metadata.max, physicalType);
+    }
+    // Returns true if no value within [min, max] satisfies the predicate.
+    bool canSkip(const StorageValue& min, const StorageValue& max,
+        common::PhysicalTypeID physicalType) const;
+
+private:
+    common::ExpressionType expressionType;
+    StorageValue value;
+};
+
+} // namespace storage
+} // namespace kuzu
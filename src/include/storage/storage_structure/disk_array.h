@@ -115,6 +115,11 @@ public:
 
     void get(uint64_t idx, transaction::TransactionType trxType, std::span<std::byte> val);
 
+    // Reads the elements at the given indices, which must be sorted, into consecutive values of
+    // vals. Elements on the same array page are copied with a single page access.
+    void get(std::span<const uint64_t> idxes, transaction::TransactionType trxType,
+        std::span<std::byte> vals);
+
     // Note: This function is to be used only by the WRITE trx.
     void update(uint64_t idx, std::span<std::byte> val);
 
@@ -196,6 +201,9 @@ protected:
 
     void updateLastPageOnDisk();
 
+    void readAPNoLock(common::page_idx_t apPageIdx, transaction::TransactionType trxType,
+        const std::function<void(uint8_t*)>& readOp);
+
     uint64_t pushBackNoLock(std::span<std::byte> val);
 
     inline uint64_t getNumElementsNoLock(transaction::TransactionType trxType) {
@@ -289,6 +297,13 @@ public:
         return val;
     }
 
+    // idxes must be sorted. See DiskArrayInternal::get.
+    inline void get(std::span<const uint64_t> idxes, transaction::TransactionType trxType,
+        std::span<U> vals) {
+        KU_ASSERT(idxes.size() == vals.size());
+        diskArray.get(idxes, trxType, std::as_writable_bytes(vals));
+    }
+
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(uint64_t newNumElements) {
         U defaultVal;
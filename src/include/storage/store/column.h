@@ -162,6 +162,9 @@ protected:
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
+    // Reads ahead the pages in [pageIdx, endPageIdx) of the chunk if pageIdx is not cached.
+    void readAheadIfNecessary(transaction::Transaction* transaction, common::page_idx_t pageIdx,
+        common::page_idx_t endPageIdx, const ColumnChunkMetadata& chunkMeta);
 
     virtual void writeValue(ChunkState& state, common::offset_t offsetInChunk,
         common::ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom);
@@ -29,6 +29,8 @@ struct ColumnChunkMetadata {
     ColumnChunkMetadata(common::page_idx_t pageIdx, common::page_idx_t numPages,
         uint64_t numNodesInChunk, const CompressionMetadata& compMeta)
         : pageIdx(pageIdx), numPages(numPages), numValues(numNodesInChunk), compMeta(compMeta) {}
+
+    bool operator==(const ColumnChunkMetadata&) const = default;
 };
 
 // Base data segment covers all fixed-sized data types.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <unordered_set>
 
 #include "storage/buffer_manager/buffer_manager.h"
@@ -77,6 +78,8 @@ private:
     std::mutex mtx;
     BufferManager& bufferManager;
     common::VirtualFileSystem* vfs;
+    // Whether records have been added since the WAL file was last synced.
+    std::atomic<bool> hasUnsyncedRecords;
 };
 
 } // namespace storage
@@ -51,7 +51,8 @@ public:
     common::transaction_t getCommitTS() const { return commitTS; }
     int64_t getCurrentTS() const { return currentTS; }
 
-    void commit(storage::WAL* wal);
+    // Applies local changes to storage. The commit record is logged by the TransactionManager.
+    void commit();
     void rollback();
 
     storage::LocalStorage* getLocalStorage() { return localStorage.get(); }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -18,6 +20,21 @@ class DBTest;
 
 namespace transaction {
 
+// Durations are in microseconds.
+struct CheckpointStats {
+    uint64_t numCheckpoints = 0;
+    // Checkpoints left to the last read-only transaction to leave, see TransactionManager::commit.
+    uint64_t numDeferredCheckpoints = 0;
+    uint64_t lastDuration = 0;
+    uint64_t maxDuration = 0;
+    uint64_t totalDuration = 0;
+    // Time spent waiting for active transactions to leave the system before checkpointing, or
+    // between a deferred checkpoint and the commit it belongs to.
+    uint64_t totalWaitDuration = 0;
+    // Microseconds since epoch at which the last checkpoint finished.
+    int64_t lastCheckpointTS = 0;
+};
+
 class TransactionManager {
     friend class testing::DBTest;
 
@@ -36,6 +53,11 @@ public:
         bool skipCheckPointing = false);
     void checkpoint(main::ClientContext& clientContext);
 
+    CheckpointStats getCheckpointStats() {
+        std::unique_lock<std::mutex> lck{mtxForCheckpointStats};
+        return checkpointStats;
+    }
+
     // Warning: Below public functions are for tests only
     std::unordered_set<uint64_t>& getActiveReadOnlyTransactionIDs() {
         std::unique_lock<std::mutex> lck{mtxForSerializingPublicFunctionCalls};
@@ -54,6 +76,11 @@ public:
 private:
     bool canCheckpointNoLock();
     void checkpointNoLock(main::ClientContext& clientContext);
+    void checkpointIfDeferredNoLock(main::ClientContext& clientContext);
+    void replayWALNoLock(main::ClientContext& clientContext);
+    static void waitForAsyncReads(main::ClientContext& clientContext);
+    void updateCheckpointStats(std::chrono::steady_clock::time_point startTime,
+        std::chrono::steady_clock::time_point waitEndTime, bool isDeferred);
     // This functions locks the mutex to start new transactions. This lock needs to be manually
     // unlocked later by calling allowReceivingNewTransactions() by the thread that called
     // stopNewTransactionsAndWaitUntilAllTransactionsLeave().
@@ -79,7 +106,16 @@ private:
     // function, which needs to let calls to comming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
+    // Set while a committed write transaction waits for read-only transactions to leave before it
+    // is checkpointed. New transactions wait on the condition variable until it is cleared.
+    bool hasDeferredCheckpoint = false;
+    std::chrono::steady_clock::time_point deferredCheckpointCommitTime;
+    std::condition_variable cvForDeferredCheckpoint;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+    // Checkpoint stats are guarded by a separate mutex so that they can be read while a
+    // checkpoint is in progress.
+    std::mutex mtxForCheckpointStats;
+    CheckpointStats checkpointStats;
 };
 } // namespace transaction
 } // namespace kuzu
@@ -1,6 +1,7 @@
 #include "main/client_context.h"
 
 #include "binder/binder.h"
+#include "binder/expression/expression_util.h"
 #include "common/exception/connection.h"
 #include "common/exception/runtime.h"
 #include "common/random_engine.h"
@@ -10,11 +11,15 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/streaming_query.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
+#include "parser/visitor/statement_plan_cache_analyzer.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/storage_manager.h"
@@ -63,14 +68,21 @@ ClientContext::ClientContext(Database* database)
     clientConfig.recursivePatternSemantic = ClientConfigDefault::RECURSIVE_PATTERN_SEMANTIC;
     clientConfig.recursivePatternCardinalityScaleFactor =
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
+    clientConfig.hashJoinMemoryLimit = static_cast<uint64_t>(
+        database->dbConfig.bufferPoolSize * ClientConfigDefault::HASH_JOIN_MEMORY_LIMIT_RATIO);
+    clientConfig.copyRelMemoryLimit = static_cast<uint64_t>(
+        database->dbConfig.bufferPoolSize * ClientConfigDefault::COPY_REL_MEMORY_LIMIT_RATIO);
+    clientConfig.enableStreamingResult = ClientConfigDefault::ENABLE_STREAMING_RESULT;
 }
 
-ClientContext::~ClientContext() = default;
+ClientContext::~ClientContext() {
+    closeStreamingQueryNoLock();
+}
 
-uint64_t ClientContext::getTimeoutRemainingInMS() const {
-    KU_ASSERT(hasTimeout());
+uint64_t ClientContext::getTimeoutRemainingInMS(uint64_t timeoutInMS) const {
+    KU_ASSERT(timeoutInMS != 0);
     const auto elapsed = activeQuery.timer.getElapsedTimeInMS();
-    return elapsed >= clientConfig.timeoutInMS ? 0 : clientConfig.timeoutInMS - elapsed;
+    return elapsed >= timeoutInMS ? 0 : timeoutInMS - elapsed;
 }
 
 void ClientContext::startTimer() {
@@ -231,6 +243,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
         return preparedStatementWithError("Connection Exception: Query is empty.");
     }
     std::unique_lock<std::mutex> lck{mtx};
+    closeStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -247,6 +260,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
 std::unique_ptr<PreparedStatement> ClientContext::prepareTest(std::string_view query) {
     auto preparedStatement = std::unique_ptr<PreparedStatement>();
     std::unique_lock<std::mutex> lck{mtx};
+    closeStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -271,6 +285,7 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans) {
     lock_t lck{mtx};
+    closeStreamingQueryNoLock();
     if (query.empty()) {
         return queryResultWithError("Connection Exception: Query is empty.");
     }
@@ -285,8 +300,14 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult = executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get(), 0u,
-            false /*requiredNexTx*/);
+        std::unique_ptr<QueryResult> currentQueryResult;
+        // Statements run one after another, so only the result of the last one can be streamed.
+        if (statement == parsedStatements.back() && canStreamResultNoLock(*preparedStatement)) {
+            currentQueryResult = executeStreamingNoLock(std::move(preparedStatement));
+        } else {
+            currentQueryResult = executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get(),
+                0u, false /*requiredNexTx*/);
+        }
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -332,18 +353,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
         }
         preparedStatement->parsedStatement = parsedStatement;
         if (parsedStatement->requireTx()) {
-            if (transactionContext->isAutoTransaction()) {
-                transactionContext->beginAutoTransaction(preparedStatement->readOnly);
-            } else {
-                transactionContext->validateManualTransaction(preparedStatement->readOnly);
-            }
-            if (!this->getTx()->isReadOnly()) {
-                if (this->remoteDatabase == nullptr) {
-                    localDatabase->storageManager->initStatistics();
-                } else {
-                    remoteDatabase->getStorageManager()->initStatistics();
-                }
-            }
+            beginTransactionNoLock(preparedStatement->readOnly);
         }
         // binding
         auto binder = Binder(this);
@@ -394,6 +404,21 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     return preparedStatement;
 }
 
+void ClientContext::beginTransactionNoLock(bool readOnlyStatement) {
+    if (transactionContext->isAutoTransaction()) {
+        transactionContext->beginAutoTransaction(readOnlyStatement);
+    } else {
+        transactionContext->validateManualTransaction(readOnlyStatement);
+    }
+    if (!this->getTx()->isReadOnly()) {
+        if (this->remoteDatabase == nullptr) {
+            localDatabase->storageManager->initStatistics();
+        } else {
+            remoteDatabase->getStorageManager()->initStatistics();
+        }
+    }
+}
+
 std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_view query) {
     std::vector<std::shared_ptr<Statement>> statements;
     if (query.empty()) {
@@ -420,6 +445,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
         inputParams) { // NOLINT(performance-unnecessary-value-param): It doesn't make sense to pass
                        // the map as a const reference.
     lock_t lck{mtx};
+    closeStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -428,11 +454,68 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     } catch (std::exception& e) {
         return queryResultWithError(e.what());
     }
-    // rebind
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
+    if (canReuseCachedPlanNoLock(*preparedStatement)) {
+        return executeCachedPlanNoLock(preparedStatement);
+    }
+    // rebind
+    auto cachedPlan = std::make_unique<CachedPreparedPlan>();
+    cachedPlan->catalog = getCatalog();
+    cachedPlan->catalogVersion = cachedPlan->catalog->getVersion();
+    cachedPlan->clientConfig = clientConfig;
+    for (auto& [name, value] : preparedStatement->parameterMap) {
+        cachedPlan->parameterTypes.insert({name, *value->getDataType()});
+    }
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeAndAutoCommitIfNecessaryNoLock(rebindPreparedStatement.get(), 0u, false);
+    auto statementToExecute = rebindPreparedStatement.get();
+    preparedStatement->cachedPlan.reset();
+    if (rebindPreparedStatement->isSuccess() &&
+        StatementPlanCacheAnalyzer().isCacheable(*preparedStatement->parsedStatement)) {
+        cachedPlan->statement = std::move(rebindPreparedStatement);
+        preparedStatement->cachedPlan = std::move(cachedPlan);
+    }
+    return executeAndAutoCommitIfNecessaryNoLock(statementToExecute, 0u, false);
+}
+
+bool ClientContext::canReuseCachedPlanNoLock(const PreparedStatement& preparedStatement) const {
+    auto cachedPlan = preparedStatement.cachedPlan.get();
+    if (cachedPlan == nullptr) {
+        return false;
+    }
+    auto catalog = getCatalog();
+    if (cachedPlan->catalog != catalog || cachedPlan->catalogVersion != catalog->getVersion() ||
+        cachedPlan->clientConfig != clientConfig) {
+        return false;
+    }
+    // Parameter expressions are bound with the data types of their values. A different data type
+    // may lead to different function overloads, casts or even a different plan.
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        if (!cachedPlan->parameterTypes.contains(name) ||
+            cachedPlan->parameterTypes.at(name) != *value->getDataType()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeCachedPlanNoLock(
+    PreparedStatement* preparedStatement) {
+    auto cachedStatement = preparedStatement->cachedPlan->statement.get();
+    auto compilingTimer = TimeMetric(true /* enable */);
+    compilingTimer.start();
+    try {
+        if (cachedStatement->parsedStatement->requireTx()) {
+            beginTransactionNoLock(cachedStatement->readOnly);
+        }
+    } catch (std::exception& e) {
+        transactionContext->rollback();
+        return queryResultWithError(e.what());
+    }
+    compilingTimer.stop();
+    cachedStatement->preparedSummary.compilingTime = compilingTimer.getElapsedTimeMS();
+    cachedStatement->preparedSummary.planCacheHit = true;
+    return executeAndAutoCommitIfNecessaryNoLock(cachedStatement, 0u, false);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -506,14 +589,76 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     executingTimer.stop();
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    queryResult->querySummary->timeToFirstTuple = queryResult->querySummary->executionTime;
     queryResult->initResultTableAndIterator(std::move(resultFT),
-        preparedStatement->statementResult->getColumns());
+        preparedStatement->statementResult->getColumns(), clientConfig.numThreads);
     return queryResult;
 }
 
+bool ClientContext::canStreamResultNoLock(const PreparedStatement& preparedStatement) const {
+    // The transaction of a streaming query stays open until the query completes, which is only
+    // safe for the auto transaction of a read-only query. The query does not wait for its result
+    // to be read, but a checkpoint deferred while it runs (see TransactionManager::commit) still
+    // holds back new transactions of the database until it completes.
+    return clientConfig.enableStreamingResult && preparedStatement.isSuccess() &&
+           preparedStatement.preparedSummary.statementType == StatementType::QUERY &&
+           preparedStatement.isReadOnly() && transactionContext->isAutoTransaction() &&
+           transactionContext->hasActiveTransaction();
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeStreamingNoLock(
+    std::unique_ptr<PreparedStatement> preparedStatement) {
+    KU_ASSERT(streamingQuery == nullptr);
+    this->resetActiveQuery();
+    this->startTimer();
+    std::shared_ptr<PhysicalPlan> physicalPlan;
+    try {
+        physicalPlan = PlanMapper(this).mapLogicalPlanToPhysical(
+            preparedStatement->logicalPlans[0].get(),
+            preparedStatement->statementResult->getColumns());
+    } catch (std::exception& e) {
+        this->transactionContext->rollback();
+        return queryResultWithError(e.what());
+    }
+    auto chunkQueue = std::make_shared<ResultChunkQueue>(this,
+        ExpressionUtil::getDataTypes(preparedStatement->statementResult->getColumns()));
+    ku_dynamic_cast<PhysicalOperator*, ResultCollector*>(physicalPlan->lastOperator.get())
+        ->setResultChunkQueue(chunkQueue);
+    auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
+    streamingQuery = std::make_shared<StreamingQuery>(this, chunkQueue);
+    queryResult->initStreamingResult(streamingQuery,
+        preparedStatement->statementResult->getColumns(), clientConfig.numThreads);
+    auto profiler = std::make_shared<Profiler>();
+    auto executionContext = std::make_shared<ExecutionContext>(profiler.get(), this);
+    // The plan and the statement it is mapped from are kept alive until the query completes.
+    std::shared_ptr<PreparedStatement> statement = std::move(preparedStatement);
+    streamingQuery->start(
+        [this, chunkQueue, statement, physicalPlan, profiler, executionContext]() {
+            try {
+                localDatabase->queryProcessor->execute(physicalPlan.get(),
+                    executionContext.get());
+                transactionContext->commit();
+            } catch (std::exception& e) {
+                transactionContext->rollback();
+                chunkQueue->finish(e.what());
+                return;
+            }
+            chunkQueue->finish();
+        });
+    return queryResult;
+}
+
+void ClientContext::closeStreamingQueryNoLock() {
+    if (streamingQuery != nullptr) {
+        streamingQuery->close();
+        streamingQuery.reset();
+    }
+}
+
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
+    closeStreamingQueryNoLock();
     // check if we are on AutoCommit. In this case we should start a transaction
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
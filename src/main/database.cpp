@@ -28,8 +28,11 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize)
-    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly) {
+    bool readOnly, uint64_t maxDBSize, bool scanResistantEviction, uint64_t readAheadNumPages,
+    bool asyncReadAhead)
+    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly),
+      scanResistantEviction{scanResistantEviction}, readAheadNumPages{readAheadNumPages},
+      asyncReadAhead{asyncReadAhead} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -57,6 +60,9 @@ SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, boo
         maxDBSize = BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE;
     }
     this->maxDBSize = maxDBSize;
+    if (readAheadNumPages == -1u) {
+        this->readAheadNumPages = BufferPoolConstants::DEFAULT_READ_AHEAD_NUM_PAGES;
+    }
 }
 
 static void getLockFileFlagsAndType(bool readOnly, bool createNew, int& flags, FileLockType& lock) {
@@ -75,8 +81,11 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     auto clientContext = ClientContext(this);
     auto dbPathStr = std::string(databasePath);
     this->databasePath = vfs->expandPath(&clientContext, dbPathStr);
-    bufferManager =
-        std::make_unique<BufferManager>(this->dbConfig.bufferPoolSize, this->dbConfig.maxDBSize);
+    auto evictionPolicy = this->dbConfig.scanResistantEviction ? EvictionPolicy::SCAN_RESISTANT :
+                                                                 EvictionPolicy::FIFO;
+    bufferManager = std::make_unique<BufferManager>(this->dbConfig.bufferPoolSize,
+        this->dbConfig.maxDBSize, evictionPolicy, this->dbConfig.readAheadNumPages,
+        this->dbConfig.asyncReadAhead);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get(), nullptr);
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->dbConfig.maxNumThreads);
     initAndLockDBDir();
@@ -18,7 +18,9 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(HomeDirectorySetting), GET_CONFIGURATION(FileSearchPathSetting),
     GET_CONFIGURATION(ProgressBarSetting), GET_CONFIGURATION(ProgressBarTimerSetting),
     GET_CONFIGURATION(RecursivePatternSemanticSetting),
-    GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting)};
+    GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
+    GET_CONFIGURATION(HashJoinMemoryLimitSetting), GET_CONFIGURATION(CopyRelMemoryLimitSetting),
+    GET_CONFIGURATION(EnableStreamingResultSetting)};
 
 DBConfig::DBConfig(SystemConfig& systemConfig) {
     bufferPoolSize = systemConfig.bufferPoolSize;
@@ -26,6 +28,9 @@ DBConfig::DBConfig(SystemConfig& systemConfig) {
     enableCompression = systemConfig.enableCompression;
     readOnly = systemConfig.readOnly;
     maxDBSize = systemConfig.maxDBSize;
+    scanResistantEviction = systemConfig.scanResistantEviction;
+    readAheadNumPages = systemConfig.readAheadNumPages;
+    asyncReadAhead = systemConfig.asyncReadAhead;
 }
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
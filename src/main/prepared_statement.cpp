@@ -2,6 +2,7 @@
 
 #include "binder/bound_statement_result.h" // IWYU pragma: keep (used to avoid error in destructor)
 #include "common/enums/statement_type.h"
+#include "main/plan_cache.h" // IWYU pragma: keep (used to avoid error in destructor)
 #include "planner/operator/logical_plan.h"
 
 using namespace kuzu::common;
@@ -5,6 +5,7 @@
 #include "common/exception/runtime.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
+#include "main/streaming_query.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -23,13 +24,25 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary) {
     queryResultIterator = QueryResultIterator{this};
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (streamingQuery != nullptr) {
+        streamingQuery->close();
+    }
+}
 
 bool QueryResult::isSuccess() const {
+    if (streamingQuery != nullptr && streamingQuery->getChunkQueue()->getErrorMessage()) {
+        return false;
+    }
     return success;
 }
 
 std::string QueryResult::getErrorMessage() const {
+    if (streamingQuery != nullptr) {
+        if (auto streamingErrMsg = streamingQuery->getChunkQueue()->getErrorMessage()) {
+            return *streamingErrMsg;
+        }
+    }
     return errMsg;
 }
 
@@ -46,40 +59,90 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
+    if (streamingQuery != nullptr) {
+        auto chunkQueue = streamingQuery->getChunkQueue();
+        if (!chunkQueue->isFinished()) {
+            throw RuntimeException("The number of tuples of a streamed query result is only known "
+                                   "once the query completes.");
+        }
+        return chunkQueue->getNumTuples();
+    }
     return factorizedTable->getTotalNumFlatTuples();
 }
 
 QuerySummary* QueryResult::getQuerySummary() const {
+    if (streamingQuery != nullptr) {
+        auto chunkQueue = streamingQuery->getChunkQueue();
+        querySummary->timeToFirstTuple = chunkQueue->getTimeToFirstChunk().value_or(0);
+        querySummary->executionTime = chunkQueue->getExecutionTime().value_or(0);
+    }
     return querySummary.get();
 }
 
 void QueryResult::resetIterator() {
+    if (streamingQuery != nullptr) {
+        throw RuntimeException("Cannot reset the iterator of a streamed query result.");
+    }
     iterator->resetState();
 }
 
-void QueryResult::initResultTableAndIterator(
-    std::shared_ptr<processor::FactorizedTable> factorizedTable_,
-    const binder::expression_vector& columns) {
-    factorizedTable = std::move(factorizedTable_);
+void QueryResult::initColumns(const binder::expression_vector& columns) {
     tuple = std::make_shared<FlatTuple>();
-    std::vector<Value*> valuesToCollect;
     for (auto i = 0u; i < columns.size(); ++i) {
         auto column = columns[i].get();
         auto columnType = column->getDataType();
         auto columnName = column->hasAlias() ? column->getAlias() : column->toString();
         columnDataTypes.push_back(columnType);
         columnNames.push_back(columnName);
-        std::unique_ptr<Value> value =
-            std::make_unique<Value>(Value::createDefaultValue(columnType));
-        valuesToCollect.push_back(value.get());
-        tuple->addValue(std::move(value));
+        tuple->addValue(std::make_unique<Value>(Value::createDefaultValue(columnType)));
+    }
+}
+
+static std::vector<Value*> getValuesToCollect(const FlatTuple& tuple) {
+    std::vector<Value*> valuesToCollect;
+    for (auto i = 0u; i < tuple.len(); ++i) {
+        valuesToCollect.push_back(tuple.getValue(i));
     }
-    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
+    return valuesToCollect;
+}
+
+void QueryResult::initResultTableAndIterator(
+    std::shared_ptr<processor::FactorizedTable> factorizedTable_,
+    const binder::expression_vector& columns, uint64_t numThreads_) {
+    initColumns(columns);
+    numThreads = numThreads_;
+    factorizedTable = std::move(factorizedTable_);
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, getValuesToCollect(*tuple));
+}
+
+void QueryResult::initStreamingResult(std::shared_ptr<StreamingQuery> streamingQuery_,
+    const binder::expression_vector& columns, uint64_t numThreads_) {
+    initColumns(columns);
+    numThreads = numThreads_;
+    streamingQuery = std::move(streamingQuery_);
+}
+
+void QueryResult::fetchNextChunkIfNecessary() {
+    if (streamingQuery == nullptr || (iterator != nullptr && iterator->hasNextFlatTuple())) {
+        return;
+    }
+    auto chunkQueue = streamingQuery->getChunkQueue();
+    if (!chunkQueue->hasNextChunk()) {
+        return;
+    }
+    // Drop the chunk that is read completely before taking the next one.
+    iterator.reset();
+    factorizedTable = chunkQueue->popChunk();
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, getValuesToCollect(*tuple));
 }
 
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
-    return iterator->hasNextFlatTuple();
+    if (iterator != nullptr && iterator->hasNextFlatTuple()) {
+        return true;
+    }
+    // Waits for the next chunk of a streamed result.
+    return streamingQuery != nullptr && streamingQuery->getChunkQueue()->hasNextChunk();
 }
 
 bool QueryResult::hasNextQueryResult() const {
@@ -100,6 +163,7 @@ std::shared_ptr<FlatTuple> QueryResult::getNext() {
             "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
     }
     validateQuerySucceed();
+    fetchNextChunkIfNecessary();
     iterator->getNextFlatTuple();
     return tuple;
 }
@@ -115,7 +179,9 @@ std::string QueryResult::toString() {
             result += columnNames[i];
         }
         result += "\n";
-        resetIterator();
+        if (streamingQuery == nullptr) {
+            resetIterator();
+        }
         while (hasNext()) {
             getNext();
             result += tuple->toString();
@@ -15,6 +15,14 @@ double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
 
+double QuerySummary::getTimeToFirstTuple() const {
+    return timeToFirstTuple;
+}
+
+bool QuerySummary::isPlanCacheHit() const {
+    return preparedSummary.planCacheHit;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
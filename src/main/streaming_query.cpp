@@ -0,0 +1,34 @@
+#include "main/streaming_query.h"
+
+#include "main/client_context.h"
+
+namespace kuzu {
+namespace main {
+
+StreamingQuery::~StreamingQuery() {
+    close();
+}
+
+void StreamingQuery::start(std::function<void()> executeFunc) {
+    KU_ASSERT(!thread.joinable());
+    thread = std::thread(std::move(executeFunc));
+}
+
+void StreamingQuery::close() {
+    std::unique_lock lck{mtx};
+    if (closed) {
+        return;
+    }
+    closed = true;
+    if (!chunkQueue->isFinished()) {
+        // Wakes up threads waiting for the reader and interrupts the rest of the query.
+        chunkQueue->close();
+        clientContext->interrupt();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+} // namespace main
+} // namespace kuzu
@@ -7,6 +7,7 @@
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_file.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 
 using namespace kuzu::binder;
@@ -28,6 +29,12 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitOperator(
     }
     case LogicalOperatorType::CROSS_PRODUCT: {
         return visitCrossProductReplace(op);
+    }
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        return visitScanNodeTableReplace(op);
+    }
+    case LogicalOperatorType::SCAN_FILE: {
+        return visitScanFileReplace(op);
     }
         // TODO(Guodong/Xiyang/Ben): Add back filter push down to node tables.
     default: { // Stop current push down for unhandled operator.
@@ -117,6 +124,61 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     return appendFilters(predicates, hashJoin);
 }
 
+static bool isConstant(const Expression& expression) {
+    return expression.expressionType == ExpressionType::LITERAL ||
+           expression.expressionType == ExpressionType::PARAMETER;
+}
+
+static bool isColumnConstantComparison(const Expression& predicate,
+    const expression_set& columns) {
+    if (!isExpressionComparison(predicate.expressionType) || predicate.getNumChildren() != 2) {
+        return false;
+    }
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    if (isConstant(*right)) {
+        return columns.contains(left);
+    }
+    if (isConstant(*left)) {
+        return columns.contains(right);
+    }
+    return false;
+}
+
+std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableReplace(
+    const std::shared_ptr<LogicalOperator>& op) {
+    auto scan = op->ptrCast<LogicalScanNodeTable>();
+    if (scan->getScanType() != LogicalScanNodeTableType::SCAN ||
+        scan->hasRecursiveJoinScanInfo()) {
+        return finishPushDown(op);
+    }
+    auto properties = scan->getProperties();
+    auto propertySet = expression_set{properties.begin(), properties.end()};
+    expression_vector propertyPredicates;
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        if (isColumnConstantComparison(*predicate, propertySet)) {
+            propertyPredicates.push_back(predicate);
+        }
+    }
+    scan->setPropertyPredicates(std::move(propertyPredicates));
+    return finishPushDown(op);
+}
+
+std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanFileReplace(
+    const std::shared_ptr<LogicalOperator>& op) {
+    auto scanFile = op->ptrCast<LogicalScanFile>();
+    auto& columns = scanFile->getInfo()->columns;
+    auto columnSet = expression_set{columns.begin(), columns.end()};
+    expression_vector columnPredicates;
+    for (auto& predicate : predicateSet.getAllPredicates()) {
+        if (isColumnConstantComparison(*predicate, columnSet)) {
+            columnPredicates.push_back(predicate);
+        }
+    }
+    scanFile->setColumnPredicates(std::move(columnPredicates));
+    return finishPushDown(op);
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodePropertyReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     return op;
@@ -0,0 +1,17 @@
+#include "parser/visitor/statement_plan_cache_analyzer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace parser {
+
+bool StatementPlanCacheAnalyzer::isCacheable(const Statement& statement) {
+    if (statement.getStatementType() != StatementType::QUERY) {
+        return false;
+    }
+    visit(statement);
+    return cacheable;
+}
+
+} // namespace parser
+} // namespace kuzu
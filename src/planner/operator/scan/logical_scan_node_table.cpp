@@ -5,7 +5,8 @@ namespace planner {
 
 LogicalScanNodeTable::LogicalScanNodeTable(const LogicalScanNodeTable& other)
     : LogicalOperator{type_}, scanType{other.scanType}, nodeID{other.nodeID},
-      nodeTableIDs{other.nodeTableIDs}, properties{other.properties} {
+      nodeTableIDs{other.nodeTableIDs}, properties{other.properties},
+      propertyPredicates{other.propertyPredicates} {
     if (other.hasRecursiveJoinScanInfo()) {
         setRecursiveJoinScanInfo(other.recursiveJoinScanInfo->copy());
     }
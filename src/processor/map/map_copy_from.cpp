@@ -167,6 +167,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapPartitioner(LogicalOperator* lo
         columnTypes.push_back(info->columnTypes);
     }
     auto sharedState = std::make_shared<PartitionerSharedState>(std::move(columnTypes));
+    sharedState->memoryLimit = clientContext->getClientConfig()->copyRelMemoryLimit;
     return std::make_unique<Partitioner>(std::make_unique<ResultSetDescriptor>(outFSchema),
         std::move(infos), std::move(sharedState), std::move(prevOperator), getOperatorID(),
         logicalPartitioner->getExpressionsForPrinting());
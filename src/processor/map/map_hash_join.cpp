@@ -86,6 +86,16 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    // Tuples are spilled as raw rows, which only hold flat columns.
+    auto memoryLimit = clientContext->getClientConfig()->hashJoinMemoryLimit;
+    auto canSpill = memoryLimit > 0;
+    for (auto i = 0u; i < buildKeys.size() + payloads.size(); i++) {
+        canSpill &= buildInfo->getTableSchema()->getColumn(i)->isFlat();
+    }
+    if (canSpill) {
+        sharedState->enableSpilling(memoryLimit, LogicalType::copy(buildKeyTypes),
+            ExpressionUtil::getDataTypes(payloads));
+    }
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema), sharedState,
             std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(), paramsString);
@@ -99,6 +109,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
         probePayloadsOutPos.emplace_back(outSchema->getExpressionPos(*payload));
     }
     ProbeDataInfo probeDataInfo(probeKeysDataPos, probePayloadsOutPos);
+    auto probeSchema = hashJoin->getChild(0)->getSchema();
+    for (auto i = 0u; i < probeSchema->getNumGroups(); i++) {
+        for (auto& expression : probeSchema->getExpressionsInScope(i)) {
+            probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+        }
+    }
     if (hashJoin->hasMark()) {
         auto mark = hashJoin->getMark();
         auto markOutputPos = DataPos(outSchema->getExpressionPos(*mark));
@@ -1,4 +1,6 @@
 #include "planner/operator/extend/logical_recursive_extend.h"
+#include "planner/operator/logical_accumulate.h"
+#include "processor/operator/result_collector.h"
 #include "processor/operator/recursive_extend/recursive_join.h"
 #include "processor/plan_mapper.h"
 #include "storage/storage_manager.h"
@@ -10,14 +12,70 @@ namespace kuzu {
 namespace processor {
 
 static std::shared_ptr<RecursiveJoinSharedState> createSharedState(
-    const binder::NodeExpression& nbrNode, const storage::StorageManager& storageManager) {
+    const binder::NodeExpression& nbrNode, const storage::StorageManager& storageManager,
+    std::unique_ptr<MultiSourceBFSSharedState> multiSourceBFSSharedState) {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
     for (auto tableID : nbrNode.getTableIDs()) {
         auto nodeTable = common::ku_dynamic_cast<storage::Table*, storage::NodeTable*>(
             storageManager.getTable(tableID));
         semiMasks.push_back(std::make_unique<NodeOffsetSemiMask>(nodeTable));
     }
-    return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks));
+    return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks),
+        std::move(multiSourceBFSSharedState));
+}
+
+static bool canUseMultiSourceBFS(const LogicalRecursiveExtend& extend) {
+    if (extend.getJoinType() != RecursiveJoinType::TRACK_NONE) {
+        return false;
+    }
+    switch (extend.getRel()->getRelType()) {
+    case common::QueryRelType::SHORTEST:
+    case common::QueryRelType::VARIABLE_LENGTH:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Sources of a recursive extend are accumulated (see Planner::appendRecursiveExtend). Read them
+// from the accumulated table, so that their BFS can be computed in batches.
+std::unique_ptr<MultiSourceBFSSharedState> PlanMapper::createMultiSourceBFSSharedState(
+    const LogicalRecursiveExtend& extend) {
+    if (!canUseMultiSourceBFS(extend)) {
+        return nullptr;
+    }
+    auto op = extend.getChild(0).get();
+    while (op->getOperatorType() == LogicalOperatorType::FLATTEN ||
+           op->getOperatorType() == LogicalOperatorType::NODE_LABEL_FILTER) {
+        op = op->getChild(0).get();
+    }
+    if (op->getOperatorType() != LogicalOperatorType::ACCUMULATE ||
+        !logicalOpToPhysicalOpMap.contains(op)) {
+        return nullptr;
+    }
+    auto payloads = op->constPtrCast<LogicalAccumulate>()->getPayloads();
+    auto srcNodeIDExpr = extend.getBoundNode()->getInternalID();
+    ft_col_idx_t srcColIdx = 0;
+    while (srcColIdx < payloads.size() && *payloads[srcColIdx] != *srcNodeIDExpr) {
+        srcColIdx++;
+    }
+    if (srcColIdx == payloads.size()) {
+        return nullptr;
+    }
+    auto physicalOp = logicalOpToPhysicalOpMap.at(op);
+    KU_ASSERT(physicalOp->getOperatorType() == PhysicalOperatorType::IN_QUERY_CALL);
+    KU_ASSERT(physicalOp->getChild(0)->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR);
+    auto resultCollector = physicalOp->getChild(0)->ptrCast<ResultCollector>();
+    // Sources are bound nodes that pass the label filter on the recursive node tables.
+    auto recursiveNodeTableIDs = extend.getRel()->getRecursiveInfo()->node->getTableIDsSet();
+    std::unordered_set<common::table_id_t> srcTableIDs;
+    for (auto tableID : extend.getBoundNode()->getTableIDsSet()) {
+        if (recursiveNodeTableIDs.contains(tableID)) {
+            srcTableIDs.insert(tableID);
+        }
+    }
+    return std::make_unique<MultiSourceBFSSharedState>(resultCollector->getResultFactorizedTable(),
+        srcColIdx, std::move(srcTableIDs));
 }
 
 std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator* logicalOperator) {
@@ -33,7 +91,6 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     // Generate RecursiveJoin
     auto outSchema = extend->getSchema();
     auto inSchema = extend->getChild(0)->getSchema();
-    auto sharedState = createSharedState(*nbrNode, *clientContext->getStorageManager());
     // Data info
     auto dataInfo = RecursiveJoinDataInfo();
     dataInfo.srcNodePos = getDataPos(*boundNode->getInternalID(), *inSchema);
@@ -67,6 +124,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     info.joinType = extend->getJoinType();
     info.direction = extend->getDirection();
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+    auto sharedState = createSharedState(*nbrNode, *clientContext->getStorageManager(),
+        createMultiSourceBFSSharedState(*extend));
     return std::make_unique<RecursiveJoin>(std::move(info), sharedState, std::move(prevOperator),
         getOperatorID(), extend->getExpressionsForPrinting(), std::move(recursiveRoot));
 }
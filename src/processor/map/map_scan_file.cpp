@@ -21,6 +21,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanFile(LogicalOperator* logic
     auto info = TableFunctionCallInfo();
     info.function = scanFileInfo->func;
     info.bindData = scanFileInfo->bindData->copy();
+    info.bindData->columnPredicates =
+        getColumnPredicates(scanFileInfo->columns, scanFile->getColumnPredicates());
     info.outPosV = outPosV;
     if (scanFile->hasOffset()) {
         info.rowOffsetPos = getDataPos(*scanFile->getOffset(), *outSchema);
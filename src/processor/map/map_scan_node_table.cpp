@@ -1,3 +1,5 @@
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression/property_expression.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/operator/scan/lookup_node_table.h"
@@ -8,10 +10,68 @@
 using namespace kuzu::binder;
 using namespace kuzu::common;
 using namespace kuzu::planner;
+using namespace kuzu::storage;
 
 namespace kuzu {
 namespace processor {
 
+// Rewrite "constant <op> property" as "property <op'> constant".
+static ExpressionType reverseComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+static Value getConstantValue(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::LITERAL) {
+        return expression.constCast<LiteralExpression>().getValue();
+    }
+    KU_ASSERT(expression.expressionType == ExpressionType::PARAMETER);
+    return expression.constCast<ParameterExpression>().getValue();
+}
+
+std::vector<std::vector<ColumnPredicate>> PlanMapper::getColumnPredicates(
+    const expression_vector& columns, const expression_vector& predicates) {
+    std::vector<std::vector<ColumnPredicate>> columnPredicates(columns.size());
+    for (auto& predicate : predicates) {
+        auto column = predicate->getChild(0);
+        auto constant = predicate->getChild(1);
+        auto expressionType = predicate->expressionType;
+        if (column->expressionType == ExpressionType::LITERAL ||
+            column->expressionType == ExpressionType::PARAMETER) {
+            std::swap(column, constant);
+            expressionType = reverseComparison(expressionType);
+        }
+        // Serial columns are not materialized, so they do not have statistics.
+        if (column->getDataType().getLogicalTypeID() == LogicalTypeID::SERIAL) {
+            continue;
+        }
+        auto value = getConstantValue(*constant);
+        if (*value.getDataType() != column->getDataType()) {
+            continue;
+        }
+        auto columnPredicate = ColumnPredicate::tryCreate(expressionType, value);
+        if (!columnPredicate.has_value()) {
+            continue;
+        }
+        for (auto i = 0u; i < columns.size(); ++i) {
+            if (columns[i]->getUniqueName() == column->getUniqueName()) {
+                columnPredicates[i].push_back(*columnPredicate);
+            }
+        }
+    }
+    return columnPredicates;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator* logicalOperator) {
     auto catalog = clientContext->getCatalog();
     auto storageManager = clientContext->getStorageManager();
@@ -27,6 +87,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator*
     const auto tableIDs = scan.getTableIDs();
     std::vector<ScanNodeTableInfo> tableInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
+    auto columnPredicates = getColumnPredicates(scan.getProperties(), scan.getPropertyPredicates());
     for (const auto& tableID : tableIDs) {
         std::vector<column_id_t> columnIDs;
         for (auto& expression : scan.getProperties()) {
@@ -40,7 +101,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(LogicalOperator*
             }
         }
         auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
-        tableInfos.push_back(ScanNodeTableInfo(table, std::move(columnIDs)));
+        tableInfos.push_back(ScanNodeTableInfo(table, std::move(columnIDs), columnPredicates));
         sharedStates.push_back(std::make_shared<ScanNodeTableSharedState>());
     }
     if (scan.getScanType() == planner::LogicalScanNodeTableType::SCAN) {
@@ -1,5 +1,6 @@
 #include "processor/operator/aggregate/aggregate_hash_table.h"
 
+#include "common/types/value/value.h"
 #include "common/utils.h"
 
 using namespace kuzu::common;
@@ -14,7 +15,8 @@ AggregateHashTable::AggregateHashTable(MemoryManager& memoryManager,
     const std::vector<std::unique_ptr<AggregateFunction>>& aggregateFunctions,
     const std::vector<LogicalType>& distinctAggKeyTypes, uint64_t numEntriesToAllocate,
     FactorizedTableSchema tableSchema)
-    : BaseHashTable{memoryManager, std::move(keyTypes)}, payloadTypes{std::move(payloadTypes)} {
+    : BaseHashTable{memoryManager, std::move(keyTypes)}, payloadTypes{std::move(payloadTypes)},
+      distinctAggKeyTypes{distinctAggKeyTypes} {
     initializeFT(aggregateFunctions, std::move(tableSchema));
     initializeHashTable(numEntriesToAllocate);
     KU_ASSERT(aggregateFunctions.size() == distinctAggKeyTypes.size());
@@ -59,26 +61,15 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
     return false;
 }
 
-void AggregateHashTable::merge(AggregateHashTable& other) {
+void AggregateHashTable::merge(AggregateHashTable& other, std::vector<uint8_t*>& entries) {
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
-    std::vector<ValueVector*> vectorsToScan(keyTypes.size() + payloadTypes.size());
-    std::vector<ValueVector*> groupByHashVectors(keyTypes.size());
-    std::vector<ValueVector*> groupByNonHashVectors(payloadTypes.size());
-    std::vector<std::unique_ptr<ValueVector>> hashKeyVectors(keyTypes.size());
-    std::vector<std::unique_ptr<ValueVector>> nonHashKeyVectors(groupByNonHashVectors.size());
-    for (auto i = 0u; i < keyTypes.size(); i++) {
-        auto hashKeyVec = std::make_unique<ValueVector>(keyTypes[i], &memoryManager);
-        hashKeyVec->state = vectorsToScanState;
-        vectorsToScan[i] = hashKeyVec.get();
-        groupByHashVectors[i] = hashKeyVec.get();
-        hashKeyVectors[i] = std::move(hashKeyVec);
-    }
-    for (auto i = 0u; i < payloadTypes.size(); i++) {
-        auto nonHashKeyVec = std::make_unique<ValueVector>(payloadTypes[i], &memoryManager);
-        nonHashKeyVec->state = vectorsToScanState;
-        vectorsToScan[i + keyTypes.size()] = nonHashKeyVec.get();
-        groupByNonHashVectors[i] = nonHashKeyVec.get();
-        nonHashKeyVectors[i] = std::move(nonHashKeyVec);
+    std::vector<ValueVector*> groupByHashVectors;
+    std::vector<ValueVector*> groupByNonHashVectors;
+    auto keyVectors =
+        createKeyVectors(vectorsToScanState, groupByHashVectors, groupByNonHashVectors);
+    std::vector<ValueVector*> vectorsToScan;
+    for (auto& keyVector : keyVectors) {
+        vectorsToScan.push_back(keyVector.get());
     }
     hashVector->state = vectorsToScanState;
     hashVector->setAllNonNull();
@@ -88,11 +79,13 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
+    uint64_t numEntries = entries.size();
     uint64_t startTupleIdx = 0;
-    while (startTupleIdx < other.factorizedTable->getNumTuples()) {
-        auto numTuplesToScan = std::min(other.factorizedTable->getNumTuples() - startTupleIdx,
-            DEFAULT_VECTOR_CAPACITY);
-        other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+    while (startTupleIdx < numEntries) {
+        auto numTuplesToScan = std::min(numEntries - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        resizeHashTableIfNecessary(numTuplesToScan);
+        other.factorizedTable->lookup(vectorsToScan, colIdxesToScan, entries.data(), startTupleIdx,
+            numTuplesToScan);
         findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
             vectorsToScanState.get());
         auto aggregateStateOffset = aggStateColOffsetInFT;
@@ -100,8 +93,7 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
             for (auto i = 0u; i < numTuplesToScan; i++) {
                 aggregateFunction->combineState(hashSlotsToUpdateAggState[i]->entry +
                                                     aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+                    entries[startTupleIdx + i] + aggregateStateOffset, &memoryManager);
             }
             aggregateStateOffset += aggregateFunction->getAggregateStateSize();
         }
@@ -109,6 +101,13 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     }
 }
 
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy(
+    uint64_t numEntriesToAllocate) const {
+    return std::make_unique<AggregateHashTable>(memoryManager, keyTypes, payloadTypes,
+        aggregateFunctions, distinctAggKeyTypes, numEntriesToAllocate,
+        factorizedTable->getTableSchema()->copy());
+}
+
 void AggregateHashTable::finalizeAggregateStates() {
     for (auto i = 0u; i < getNumEntries(); ++i) {
         auto entry = getEntry(i);
@@ -120,6 +119,119 @@ void AggregateHashTable::finalizeAggregateStates() {
     }
 }
 
+bool AggregateHashTable::canSpill() const {
+    return std::none_of(aggregateFunctions.begin(), aggregateFunctions.end(),
+        [](const std::unique_ptr<AggregateFunction>& aggregateFunction) {
+            return aggregateFunction->isDistinct ||
+                   aggregateFunction->getInitialNullAggregateState()->hasExternalMemory();
+        });
+}
+
+// Each entry is serialized as its group by keys, its hash value and the fields of its aggregate
+// states.
+void AggregateHashTable::serializeEntries(std::vector<uint8_t*>& entries,
+    Serializer& serializer) {
+    KU_ASSERT(canSpill());
+    std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
+    std::vector<ValueVector*> groupByHashVectors;
+    std::vector<ValueVector*> groupByNonHashVectors;
+    auto keyVectors =
+        createKeyVectors(vectorsToScanState, groupByHashVectors, groupByNonHashVectors);
+    std::vector<ValueVector*> vectorsToScan;
+    for (auto& keyVector : keyVectors) {
+        vectorsToScan.push_back(keyVector.get());
+    }
+    std::vector<uint32_t> colIdxesToScan(vectorsToScan.size());
+    iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
+    uint64_t numEntries = entries.size();
+    uint64_t startTupleIdx = 0;
+    while (startTupleIdx < numEntries) {
+        auto numTuplesToScan = std::min(numEntries - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        for (auto& keyVector : keyVectors) {
+            keyVector->resetAuxiliaryBuffer();
+        }
+        factorizedTable->lookup(vectorsToScan, colIdxesToScan, entries.data(), startTupleIdx,
+            numTuplesToScan);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            auto entry = entries[startTupleIdx + i];
+            for (auto& keyVector : keyVectors) {
+                keyVector->getAsValue(i)->serialize(serializer);
+            }
+            serializer.serializeValue(getHash(entry));
+            auto aggregateStateOffset = aggStateColOffsetInFT;
+            for (auto& aggregateFunction : aggregateFunctions) {
+                reinterpret_cast<AggregateState*>(entry + aggregateStateOffset)
+                    ->serialize(serializer);
+                aggregateStateOffset += aggregateFunction->getAggregateStateSize();
+            }
+        }
+        startTupleIdx += numTuplesToScan;
+    }
+}
+
+void AggregateHashTable::mergeSerializedEntries(Deserializer& deserializer, uint64_t numEntries) {
+    std::shared_ptr<DataChunkState> vectorsToMergeState = std::make_shared<DataChunkState>();
+    std::vector<ValueVector*> groupByHashVectors;
+    std::vector<ValueVector*> groupByNonHashVectors;
+    auto keyVectors =
+        createKeyVectors(vectorsToMergeState, groupByHashVectors, groupByNonHashVectors);
+    hashVector->state = vectorsToMergeState;
+    hashVector->setAllNonNull();
+    uint64_t numBytesForAggStates = 0;
+    for (auto& aggregateFunction : aggregateFunctions) {
+        numBytesForAggStates += aggregateFunction->getAggregateStateSize();
+    }
+    auto aggStates = std::make_unique<uint8_t[]>(DEFAULT_VECTOR_CAPACITY * numBytesForAggStates);
+    uint64_t startTupleIdx = 0;
+    while (startTupleIdx < numEntries) {
+        auto numTuplesToMerge = std::min(numEntries - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        resizeHashTableIfNecessary(numTuplesToMerge);
+        for (auto& keyVector : keyVectors) {
+            keyVector->resetAuxiliaryBuffer();
+        }
+        for (auto i = 0u; i < numTuplesToMerge; i++) {
+            for (auto& keyVector : keyVectors) {
+                keyVector->copyFromValue(i, *Value::deserialize(deserializer));
+            }
+            hash_t hash = 0;
+            deserializer.deserializeValue(hash);
+            hashVector->setValue(i, hash);
+            auto aggregateStateOffset = 0u;
+            for (auto& aggregateFunction : aggregateFunctions) {
+                auto state = aggStates.get() + i * numBytesForAggStates + aggregateStateOffset;
+                auto stateSize = aggregateFunction->getAggregateStateSize();
+                memcpy(state, aggregateFunction->getInitialNullAggregateState(), stateSize);
+                reinterpret_cast<AggregateState*>(state)->deserialize(deserializer);
+                aggregateStateOffset += stateSize;
+            }
+        }
+        vectorsToMergeState->initOriginalAndSelectedSize(numTuplesToMerge);
+        findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
+            vectorsToMergeState.get());
+        auto aggregateStateOffset = 0u;
+        for (auto& aggregateFunction : aggregateFunctions) {
+            for (auto i = 0u; i < numTuplesToMerge; i++) {
+                aggregateFunction->combineState(hashSlotsToUpdateAggState[i]->entry +
+                                                    aggStateColOffsetInFT + aggregateStateOffset,
+                    aggStates.get() + i * numBytesForAggStates + aggregateStateOffset,
+                    &memoryManager);
+            }
+            aggregateStateOffset += aggregateFunction->getAggregateStateSize();
+        }
+        startTupleIdx += numTuplesToMerge;
+    }
+}
+
+uint64_t AggregateHashTable::getMemoryUsage() const {
+    auto memoryUsage = factorizedTable->getMemoryUsage() + hashSlotsBlocks.size() * HASH_BLOCK_SIZE;
+    for (auto& distinctHashTable : distinctHashTables) {
+        if (distinctHashTable != nullptr) {
+            memoryUsage += distinctHashTable->getMemoryUsage();
+        }
+    }
+    return memoryUsage;
+}
+
 void AggregateHashTable::initializeFT(
     const std::vector<std::unique_ptr<AggregateFunction>>& aggFuncs,
     FactorizedTableSchema tableSchema) {
@@ -166,6 +278,25 @@ void AggregateHashTable::initializeTmpVectors() {
     tmpSlotIdxes = std::make_unique<uint64_t[]>(DEFAULT_VECTOR_CAPACITY);
 }
 
+std::vector<std::unique_ptr<ValueVector>> AggregateHashTable::createKeyVectors(
+    const std::shared_ptr<DataChunkState>& state, std::vector<ValueVector*>& groupByHashVectors,
+    std::vector<ValueVector*>& groupByNonHashVectors) {
+    std::vector<std::unique_ptr<ValueVector>> keyVectors;
+    for (auto& keyType : keyTypes) {
+        auto hashKeyVec = std::make_unique<ValueVector>(keyType, &memoryManager);
+        hashKeyVec->setState(state);
+        groupByHashVectors.push_back(hashKeyVec.get());
+        keyVectors.push_back(std::move(hashKeyVec));
+    }
+    for (auto& payloadType : payloadTypes) {
+        auto nonHashKeyVec = std::make_unique<ValueVector>(payloadType, &memoryManager);
+        nonHashKeyVec->setState(state);
+        groupByNonHashVectors.push_back(nonHashKeyVec.get());
+        keyVectors.push_back(std::move(nonHashKeyVec));
+    }
+    return keyVectors;
+}
+
 uint8_t* AggregateHashTable::findEntryInDistinctHT(
     const std::vector<ValueVector*>& groupByKeyVectors, hash_t hash) {
     auto slotIdx = getSlotIdxForHash(hash);
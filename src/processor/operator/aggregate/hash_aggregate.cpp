@@ -1,7 +1,8 @@
 #include "processor/operator/aggregate/hash_aggregate.h"
 
-#include "common/utils.h"
+#include "main/client_context.h"
 #include "processor/result/mark_hash_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -11,43 +12,169 @@ namespace kuzu {
 namespace processor {
 
 void HashAggregateSharedState::appendAggregateHashTable(
-    std::unique_ptr<AggregateHashTable> aggregateHashTable) {
+    std::unique_ptr<AggregateHashTable> aggregateHashTable,
+    std::vector<SpilledAggregateBucket> spilledBuckets) {
+    LocalHashTable localHashTable;
+    localHashTable.buckets.resize(NUM_BUCKETS);
+    for (auto i = 0u; i < aggregateHashTable->getNumEntries(); ++i) {
+        auto entry = aggregateHashTable->getEntry(i);
+        localHashTable.buckets[getBucketIdx(aggregateHashTable->getHash(entry))].push_back(entry);
+    }
+    localHashTable.hashTable = std::move(aggregateHashTable);
+    localHashTable.spilledBuckets = std::move(spilledBuckets);
     std::unique_lock lck{mtx};
-    localAggregateHashTables.push_back(std::move(aggregateHashTable));
+    localHashTables.push_back(std::move(localHashTable));
 }
 
-void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
-    std::unique_lock lck{mtx};
-    if (localAggregateHashTables.size() == 1) {
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-    } else {
-        auto numEntries = 0u;
-        for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
+uint64_t HashAggregateSharedState::spillAggregateHashTable(AggregateHashTable& aggregateHashTable,
+    std::vector<SpilledAggregateBucket>& spilledBuckets, main::ClientContext* context) {
+    std::vector<std::vector<uint8_t*>> buckets(NUM_BUCKETS);
+    for (auto i = 0u; i < aggregateHashTable.getNumEntries(); ++i) {
+        auto entry = aggregateHashTable.getEntry(i);
+        buckets[getBucketIdx(aggregateHashTable.getHash(entry))].push_back(entry);
+    }
+    spilledBuckets.resize(NUM_BUCKETS);
+    uint64_t numBytesSpilled = 0;
+    for (auto i = 0u; i < NUM_BUCKETS; ++i) {
+        if (buckets[i].empty()) {
+            continue;
         }
-        localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-        for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
-            globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+        auto& spilledBucket = spilledBuckets[i];
+        if (spilledBucket.file == nullptr) {
+            spilledBucket.file = std::make_unique<SpillFile>(context);
         }
+        auto sizeBefore = spilledBucket.file->getSize();
+        aggregateHashTable.serializeEntries(buckets[i], spilledBucket.file->getSerializer());
+        spilledBucket.numEntries += buckets[i].size();
+        numBytesSpilled += spilledBucket.file->getSize() - sizeBefore;
     }
+    return numBytesSpilled;
 }
 
-void HashAggregateSharedState::finalizeAggregateHashTable() {
+void HashAggregateSharedState::initPartitions() {
     std::unique_lock lck{mtx};
-    globalAggregateHashTable->finalizeAggregateStates();
+    for (auto& localHashTable : localHashTables) {
+        numEntriesUpperBound += localHashTable.hashTable->getNumEntries();
+        for (auto& spilledBucket : localHashTable.spilledBuckets) {
+            numEntriesUpperBound += spilledBucket.numEntries;
+            hasSpilledEntries |= spilledBucket.numEntries > 0;
+        }
+    }
+    auto numRadixBits = 0u;
+    if (hasSpilledEntries) {
+        // Spilled entries do not fit in memory altogether, so keep partitions as small as possible.
+        numRadixBits = NUM_RADIX_BITS;
+    } else if (localHashTables.size() > 1) {
+        while (numRadixBits < NUM_RADIX_BITS &&
+               (numEntriesUpperBound >> (numRadixBits + 1)) >= MIN_NUM_ENTRIES_PER_PARTITION) {
+            numRadixBits++;
+        }
+    }
+    numBucketsPerPartition = NUM_BUCKETS >> numRadixBits;
+    partitions.resize(localHashTables.empty() ? 0 : (uint64_t)1 << numRadixBits);
 }
 
-std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
+std::shared_ptr<AggregateHashTable> HashAggregateSharedState::getNextRangeToRead(
+    uint64_t& startOffset, uint64_t& endOffset) {
     std::unique_lock lck{mtx};
-    if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
-        return std::make_pair(currentOffset, currentOffset);
+    while (true) {
+        for (auto i = 0u; i < nextPartitionIdxToMerge; ++i) {
+            auto& partition = partitions[i];
+            if (partition.hashTable == nullptr) {
+                continue;
+            }
+            auto numEntries = partition.hashTable->getNumEntries();
+            if (partition.nextOffsetToScan >= numEntries) {
+                continue;
+            }
+            startOffset = partition.nextOffsetToScan;
+            endOffset = std::min(numEntries, startOffset + DEFAULT_VECTOR_CAPACITY);
+            partition.nextOffsetToScan = endOffset;
+            auto hashTable = partition.hashTable;
+            if (endOffset == numEntries) {
+                numScannedPartitions++;
+                partition.hashTable.reset();
+            }
+            return hashTable;
+        }
+        if (mergeFailed) {
+            return nullptr;
+        }
+        if (nextPartitionIdxToMerge < partitions.size()) {
+            auto partitionIdx = nextPartitionIdxToMerge++;
+            numMergingPartitions++;
+            lck.unlock();
+            std::unique_ptr<AggregateHashTable> hashTable;
+            try {
+                hashTable = mergePartition(partitionIdx);
+            } catch (...) {
+                lck.lock();
+                mergeFailed = true;
+                cv.notify_all();
+                throw;
+            }
+            lck.lock();
+            if (hashTable->getNumEntries() == 0) {
+                numScannedPartitions++;
+            } else {
+                partitions[partitionIdx].hashTable = std::move(hashTable);
+            }
+            numMergingPartitions--;
+            cv.notify_all();
+            continue;
+        }
+        if (numMergingPartitions == 0) {
+            return nullptr;
+        }
+        // Wait for other threads to finish merging partitions, which we can then help scanning.
+        cv.wait(lck);
     }
-    auto startOffset = currentOffset;
-    auto range = std::min(DEFAULT_VECTOR_CAPACITY,
-        globalAggregateHashTable->getNumEntries() - currentOffset);
-    currentOffset += range;
-    return std::make_pair(startOffset, startOffset + range);
+}
+
+double HashAggregateSharedState::getProgress() const {
+    if (partitions.empty()) {
+        return 0.0;
+    }
+    return static_cast<double>(numScannedPartitions.load()) / partitions.size();
+}
+
+std::unique_ptr<AggregateHashTable> HashAggregateSharedState::mergePartition(
+    uint64_t partitionIdx) {
+    std::unique_ptr<AggregateHashTable> hashTable;
+    if (localHashTables.size() == 1 && !hasSpilledEntries) {
+        KU_ASSERT(partitions.size() == 1);
+        hashTable = std::move(localHashTables[0].hashTable);
+    } else {
+        auto startBucketIdx = partitionIdx * numBucketsPerPartition;
+        auto endBucketIdx = startBucketIdx + numBucketsPerPartition;
+        uint64_t numEntries = 0;
+        for (auto& localHashTable : localHashTables) {
+            for (auto i = startBucketIdx; i < endBucketIdx; ++i) {
+                numEntries += localHashTable.buckets[i].size();
+                if (!localHashTable.spilledBuckets.empty()) {
+                    numEntries += localHashTable.spilledBuckets[i].numEntries;
+                }
+            }
+        }
+        hashTable = localHashTables[0].hashTable->createEmptyCopy(
+            static_cast<uint64_t>(numEntries * DEFAULT_HT_LOAD_FACTOR));
+        for (auto& localHashTable : localHashTables) {
+            for (auto i = startBucketIdx; i < endBucketIdx; ++i) {
+                hashTable->merge(*localHashTable.hashTable, localHashTable.buckets[i]);
+                if (localHashTable.spilledBuckets.empty() ||
+                    localHashTable.spilledBuckets[i].numEntries == 0) {
+                    continue;
+                }
+                auto& spilledBucket = localHashTable.spilledBuckets[i];
+                hashTable->mergeSerializedEntries(*spilledBucket.file->getDeserializer(),
+                    spilledBucket.numEntries);
+                // The spill file is no longer needed once merged.
+                spilledBucket.file.reset();
+            }
+        }
+    }
+    hashTable->finalizeAggregateStates();
+    return hashTable;
 }
 
 HashAggregateInfo::HashAggregateInfo(std::vector<DataPos> flatKeysPos,
@@ -114,18 +241,42 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     }
     localState.init(*resultSet, context->clientContext, hashInfo, aggregateFunctions,
         distinctAggKeyTypes);
+    if (hashInfo.hashTableType == HashTableType::AGGREGATE_HASH_TABLE &&
+        localState.aggregateHashTable->canSpill()) {
+        auto bufferPoolSize =
+            context->clientContext->getMemoryManager()->getBufferManager()->getBufferPoolSize();
+        auto numThreads = context->clientConfig.numThreads;
+        spillMemoryLimit = static_cast<uint64_t>(
+            bufferPoolSize * SPILL_MEMORY_RATIO / std::max<uint64_t>(numThreads, 1));
+    }
+    spilledBytes = context->profiler->registerNumericMetric(getSpilledBytesMetricKey());
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
         localState.append(aggInputs, resultSet->multiplicity);
+        if (spillMemoryLimit > 0 &&
+            localState.aggregateHashTable->getMemoryUsage() > spillMemoryLimit) {
+            spilledBytes->increase(HashAggregateSharedState::spillAggregateHashTable(
+                *localState.aggregateHashTable, localState.spilledBuckets,
+                context->clientContext));
+            localState.aggregateHashTable = localState.aggregateHashTable->createEmptyCopy(0);
+        }
     }
-    sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable));
+    sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable),
+        std::move(localState.spilledBuckets));
+}
+
+void HashAggregate::finalize(ExecutionContext* /*context*/) {
+    sharedState->initPartitions();
 }
 
-void HashAggregate::finalize(ExecutionContext* context) {
-    sharedState->combineAggregateHashTable(*context->clientContext->getMemoryManager());
-    sharedState->finalizeAggregateHashTable();
+std::unordered_map<std::string, std::string> HashAggregate::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"SpilledBytes",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSpilledBytesMetricKey()))});
+    return result;
 }
 
 } // namespace processor
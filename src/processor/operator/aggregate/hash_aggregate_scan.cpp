@@ -16,17 +16,17 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 }
 
 bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
-    if (startOffset >= endOffset) {
+    uint64_t startOffset = 0, endOffset = 0;
+    hashTable = sharedState->getNextRangeToRead(startOffset, endOffset);
+    if (hashTable == nullptr) {
         return false;
     }
     auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(groupByKeyVectors, startOffset, numRowsToScan,
-        groupByKeyVectorsColIdxes);
+    auto factorizedTable = hashTable->getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, startOffset, numRowsToScan, groupByKeyVectorsColIdxes);
     for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+        auto entry = hashTable->getEntry(startOffset + pos);
+        auto offset = factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
@@ -38,13 +38,7 @@ bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
 }
 
 double HashAggregateScan::getProgress(ExecutionContext* /*context*/) const {
-    uint64_t totalNumTuples = sharedState->getFactorizedTable()->getNumTuples();
-    if (totalNumTuples == 0) {
-        return 0.0;
-    } else if (sharedState->getCurrentOffset() == totalNumTuples) {
-        return 1.0;
-    }
-    return static_cast<double>(sharedState->getCurrentOffset()) / totalNumTuples;
+    return sharedState->getProgress();
 }
 
 } // namespace processor
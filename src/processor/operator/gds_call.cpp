@@ -1,7 +1,6 @@
 #include "processor/operator/gds_call.h"
 
 #include "binder/expression/graph_expression.h"
-#include "graph/on_disk_graph.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::graph;
@@ -10,17 +9,24 @@ namespace kuzu {
 namespace processor {
 
 void GDSCall::initLocalStateInternal(ResultSet*, ExecutionContext* context) {
-    info.gds->init(sharedState->graph.get(), sharedState->fTable.get(), context->clientContext);
+    info.gds->init(sharedState->graph.get(), sharedState->fTable.get(),
+        sharedState->gdsSharedState, context->clientContext);
 }
 
 void GDSCall::initGlobalStateInternal(ExecutionContext* context) {
     auto graphExpr_ = info.graphExpr->constPtrCast<GraphExpression>();
-    sharedState->graph = std::make_unique<OnDiskGraph>(context->clientContext,
-        graphExpr_->getNodeName(), graphExpr_->getRelName());
+    auto weightPropertyName =
+        info.gds->readsWeights() ? graphExpr_->getWeightPropertyName() : std::string();
+    sharedState->graph = std::make_unique<InMemoryCSRGraph>(context->clientContext,
+        graphExpr_->getNodeName(), graphExpr_->getRelName(), weightPropertyName);
+    sharedState->gdsSharedState = info.gds->createSharedState(sharedState->graph.get());
 }
 
 void GDSCall::executeInternal(ExecutionContext*) {
-    info.gds->exec();
+    sharedState->graph->scan();
+    if (info.gds->isParallel() || !sharedState->execClaimed.exchange(true)) {
+        info.gds->exec();
+    }
 }
 
 } // namespace processor
@@ -1,14 +1,196 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
+#include "common/null_buffer.h"
+#include "common/serializer/buffered_serializer.h"
+#include "main/client_context.h"
+
 using namespace kuzu::common;
 using namespace kuzu::storage;
 
 namespace kuzu {
 namespace processor {
 
-void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
-    std::unique_lock lck(mtx);
-    hashTable->merge(localHashTable);
+void HashJoinSharedState::enableSpilling(uint64_t memoryLimit,
+    std::vector<LogicalType> keyTypes, std::vector<LogicalType> payloadTypes) {
+    KU_ASSERT(memoryLimit > 0);
+    this->memoryLimit = memoryLimit;
+    columnTypes = std::move(keyTypes);
+    for (auto& payloadType : payloadTypes) {
+        columnTypes.push_back(std::move(payloadType));
+    }
+}
+
+uint64_t HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable,
+    main::ClientContext* context) {
+    {
+        std::unique_lock lck(mtx);
+        if (!isSpilled()) {
+            hashTable->merge(localHashTable);
+            return 0;
+        }
+    }
+    return spillHashTable(localHashTable, context);
+}
+
+uint64_t HashJoinSharedState::spillLocalHashTable(JoinHashTable& localHashTable,
+    main::ClientContext* context) {
+    KU_ASSERT(memoryLimit > 0);
+    uint64_t numSpilledTuples = 0;
+    {
+        std::unique_lock lck(mtx);
+        if (!isSpilled()) {
+            // Tuples merged so far are spilled as well so that each partition can be joined on its
+            // own.
+            partitions.resize(NUM_PARTITIONS);
+            for (auto& partition : partitions) {
+                partition = std::make_unique<SpilledJoinPartition>();
+            }
+            numSpilledTuples += spillHashTable(*hashTable, context);
+            hashTable = hashTable->createEmptyCopy();
+        }
+    }
+    // Once spilled, the shared hash table stays empty. Local tables are spilled without holding
+    // its lock, and only the partition being appended to is locked.
+    return numSpilledTuples + spillHashTable(localHashTable, context);
+}
+
+std::shared_ptr<JoinHashTable> HashJoinSharedState::getPartitionHashTable(uint64_t partitionIdx,
+    main::ClientContext* context) {
+    auto& partition = *partitions[partitionIdx];
+    std::unique_lock lck(partition.mtx);
+    auto result = partition.hashTable.lock();
+    if (result != nullptr) {
+        return result;
+    }
+    result = hashTable->createEmptyCopy();
+    if (partition.numTuples > 0) {
+        auto deserializer = partition.file->getDeserializer();
+        auto factorizedTable = result->getFactorizedTable();
+        auto vectors = createColumnVectors(context->getMemoryManager());
+        for (auto i = 0u; i < partition.numTuples; i++) {
+            deserializeTuple(*factorizedTable, vectors, *deserializer);
+        }
+    }
+    result->allocateHashSlots(partition.numTuples);
+    result->buildHashSlots();
+    partition.hashTable = result;
+    return result;
+}
+
+uint64_t HashJoinSharedState::spillHashTable(JoinHashTable& table, main::ClientContext* context) {
+    auto factorizedTable = table.getFactorizedTable();
+    auto numTuples = factorizedTable->getNumTuples();
+    std::vector<std::vector<uint8_t*>> tuplesPerPartition(NUM_PARTITIONS);
+    for (auto i = 0u; i < numTuples; i++) {
+        auto tuple = factorizedTable->getTuple(i);
+        tuplesPerPartition[getPartitionIdx(table.getHash(tuple))].push_back(tuple);
+    }
+    auto vectors = createColumnVectors(context->getMemoryManager());
+    // Tuples of a partition are serialized into memory first, so that the partition is only locked
+    // while they are appended to its spill file.
+    auto buffer = std::make_shared<BufferedSerializer>();
+    Serializer serializer{buffer};
+    for (auto partitionIdx = 0u; partitionIdx < NUM_PARTITIONS; partitionIdx++) {
+        auto& tuples = tuplesPerPartition[partitionIdx];
+        if (tuples.empty()) {
+            continue;
+        }
+        buffer->reset();
+        for (auto tuple : tuples) {
+            serializeTuple(*factorizedTable, tuple, vectors, serializer);
+        }
+        auto& partition = *partitions[partitionIdx];
+        std::unique_lock lck(partition.mtx);
+        if (partition.file == nullptr) {
+            partition.file = std::make_unique<SpillFile>(context);
+        }
+        partition.file->getSerializer().write(buffer->getBlobData(), buffer->getSize());
+        partition.numTuples += tuples.size();
+    }
+    return numTuples;
+}
+
+// A tuple is written as its raw row, followed by the data of its non-null cells that the row only
+// points to, i.e. long strings and nested values. Hash values are spilled along with the rows, so
+// they are not computed again when the partition is read back.
+void HashJoinSharedState::serializeTuple(const FactorizedTable& factorizedTable,
+    const uint8_t* tuple, const std::vector<std::unique_ptr<ValueVector>>& vectors,
+    Serializer& serializer) const {
+    auto tableSchema = factorizedTable.getTableSchema();
+    serializer.write(tuple, tableSchema->getNumBytesPerTuple());
+    auto nullBuffer = tuple + tableSchema->getNullMapOffset();
+    for (auto colIdx = 0u; colIdx < columnTypes.size(); colIdx++) {
+        if (factorizedTable.isNonOverflowColNull(nullBuffer, colIdx)) {
+            continue;
+        }
+        auto cell = tuple + tableSchema->getColOffset(colIdx);
+        switch (columnTypes[colIdx].getPhysicalType()) {
+        case PhysicalTypeID::STRING: {
+            auto& str = *reinterpret_cast<const ku_string_t*>(cell);
+            if (!ku_string_t::isShortString(str.len)) {
+                serializer.write(reinterpret_cast<const uint8_t*>(str.overflowPtr), str.len);
+            }
+        } break;
+        case PhysicalTypeID::LIST:
+        case PhysicalTypeID::ARRAY:
+        case PhysicalTypeID::STRUCT: {
+            auto& vector = *vectors[colIdx];
+            vector.resetAuxiliaryBuffer();
+            vector.copyFromRowData(0, cell);
+            vector.getAsValue(0)->serialize(serializer);
+        } break;
+        default:
+            break;
+        }
+    }
+}
+
+void HashJoinSharedState::deserializeTuple(FactorizedTable& factorizedTable,
+    const std::vector<std::unique_ptr<ValueVector>>& vectors, Deserializer& deserializer) const {
+    auto tableSchema = factorizedTable.getTableSchema();
+    auto tuple = factorizedTable.appendEmptyTuple();
+    deserializer.read(tuple, tableSchema->getNumBytesPerTuple());
+    auto nullBuffer = tuple + tableSchema->getNullMapOffset();
+    for (auto colIdx = 0u; colIdx < columnTypes.size(); colIdx++) {
+        if (NullBuffer::isNull(nullBuffer, colIdx)) {
+            // Marks the column as nullable in the schema of the table.
+            factorizedTable.setNonOverflowColNull(nullBuffer, colIdx);
+            continue;
+        }
+        auto cell = tuple + tableSchema->getColOffset(colIdx);
+        switch (columnTypes[colIdx].getPhysicalType()) {
+        case PhysicalTypeID::STRING: {
+            auto& str = *reinterpret_cast<ku_string_t*>(cell);
+            if (!ku_string_t::isShortString(str.len)) {
+                auto data = factorizedTable.getInMemOverflowBuffer()->allocateSpace(str.len);
+                deserializer.read(data, str.len);
+                str.overflowPtr = reinterpret_cast<uint64_t>(data);
+            }
+        } break;
+        case PhysicalTypeID::LIST:
+        case PhysicalTypeID::ARRAY:
+        case PhysicalTypeID::STRUCT: {
+            auto& vector = *vectors[colIdx];
+            vector.resetAuxiliaryBuffer();
+            vector.copyFromValue(0, *Value::deserialize(deserializer));
+            factorizedTable.updateFlatCell(tuple, colIdx, &vector, 0);
+        } break;
+        default:
+            break;
+        }
+    }
+}
+
+std::vector<std::unique_ptr<ValueVector>> HashJoinSharedState::createColumnVectors(
+    MemoryManager* memoryManager) const {
+    auto state = std::make_shared<DataChunkState>();
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    for (auto& columnType : columnTypes) {
+        auto vector = std::make_unique<ValueVector>(columnType, memoryManager);
+        vector->setState(state);
+        vectors.push_back(std::move(vector));
+    }
+    return vectors;
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -29,6 +211,12 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     }
     hashTable = std::make_unique<JoinHashTable>(*context->clientContext->getMemoryManager(),
         std::move(keyTypes), info->tableSchema.copy());
+    if (sharedState->getMemoryLimit() > 0) {
+        auto numThreads = context->clientConfig.numThreads;
+        localMemoryLimit = std::max<uint64_t>(
+            sharedState->getMemoryLimit() / std::max<uint64_t>(numThreads, 1), 1);
+    }
+    spilledTuples = context->profiler->registerNumericMetric(getSpilledTuplesMetricKey());
 }
 
 void HashJoinBuild::setKeyState(common::DataChunkState* state) {
@@ -51,9 +239,22 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             appendVectors();
         }
+        if (localMemoryLimit > 0 && hashTable->getMemoryUsage() > localMemoryLimit) {
+            spilledTuples->increase(
+                sharedState->spillLocalHashTable(*hashTable, context->clientContext));
+            hashTable = hashTable->createEmptyCopy();
+        }
     }
     // Merge with global hash table once local tuples are all appended.
-    sharedState->mergeLocalHashTable(*hashTable);
+    spilledTuples->increase(sharedState->mergeLocalHashTable(*hashTable, context->clientContext));
+}
+
+std::unordered_map<std::string, std::string> HashJoinBuild::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"SpilledTuples",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSpilledTuplesMetricKey()))});
+    return result;
 }
 
 } // namespace processor
@@ -1,5 +1,7 @@
 #include "processor/operator/hash_join/hash_join_probe.h"
 
+#include "main/client_context.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -31,6 +33,138 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64,
             context->clientContext->getMemoryManager());
     }
+    hashTable = sharedState->getHashTable();
+    if (sharedState->isSpilled()) {
+        for (auto& dataPos : probeDataInfo.probeSideDataPos) {
+            auto vector = resultSet->getValueVector(dataPos).get();
+            if (probeSideChunks.empty() || probeSideChunks.back().state != vector->state.get()) {
+                probeSideChunks.push_back(ProbeSideChunk{vector->state.get(), {}});
+            }
+            probeSideChunks.back().vectors.push_back(vector);
+        }
+        spilledProbeInputs.resize(HashJoinSharedState::getNumPartitions());
+    }
+    spilledTuples = context->profiler->registerNumericMetric(getSpilledTuplesMetricKey());
+}
+
+bool HashJoinProbe::getNextProbeInput(ExecutionContext* context) {
+    if (!sharedState->isSpilled()) {
+        return children[0]->getNextTuple(context);
+    }
+    while (!probeSideExhausted) {
+        if (!children[0]->getNextTuple(context)) {
+            probeSideExhausted = true;
+            break;
+        }
+        if (!spillProbeInput(context->clientContext)) {
+            return true;
+        }
+    }
+    return readSpilledProbeInput(context->clientContext);
+}
+
+bool HashJoinProbe::spillProbeInput(main::ClientContext* context) {
+    JoinHashTable::computeProbeHashes(keyVectors, hashVector.get(), tmpHashVector.get());
+    if (flatProbe) {
+        for (auto& keyVector : keyVectors) {
+            if (keyVector->isNull(keyVector->state->getSelVector()[0])) {
+                // There is no match in any partition. The global hash table is empty.
+                return false;
+            }
+        }
+        auto hash = hashVector->getValue<hash_t>(hashVector->state->getSelVector()[0]);
+        spillProbeInputToPartition(HashJoinSharedState::getPartitionIdx(hash),
+            nullptr /* keyPositions */, context);
+        spilledTuples->increase(1);
+        return true;
+    }
+    // Keys are probed in a batch, so each partition gets the positions of its keys. NULL keys are
+    // discarded as they are when probing in memory.
+    KU_ASSERT(keyVectors.size() == 1);
+    auto keyVector = keyVectors[0];
+    auto& selVector = keyVector->state->getSelVector();
+    std::vector<std::vector<sel_t>> keyPositionsPerPartition(
+        HashJoinSharedState::getNumPartitions());
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        if (!keyVector->isNull(pos)) {
+            auto hash = hashVector->getValue<hash_t>(pos);
+            keyPositionsPerPartition[HashJoinSharedState::getPartitionIdx(hash)].push_back(pos);
+        }
+    }
+    for (auto partitionIdx = 0u; partitionIdx < keyPositionsPerPartition.size(); partitionIdx++) {
+        auto& keyPositions = keyPositionsPerPartition[partitionIdx];
+        if (!keyPositions.empty()) {
+            spillProbeInputToPartition(partitionIdx, &keyPositions, context);
+            spilledTuples->increase(keyPositions.size());
+        }
+    }
+    return true;
+}
+
+void HashJoinProbe::spillProbeInputToPartition(uint64_t partitionIdx,
+    const std::vector<sel_t>* keyPositions, main::ClientContext* context) {
+    auto& spillFile = spilledProbeInputs[partitionIdx];
+    if (spillFile == nullptr) {
+        spillFile = std::make_unique<SpillFile>(context);
+    }
+    auto& serializer = spillFile->getSerializer();
+    serializer.serializeValue(resultSet->multiplicity);
+    for (auto& chunk : probeSideChunks) {
+        auto& selVector = chunk.state->getSelVector();
+        auto positions = chunk.state == keyVectors[0]->state.get() ? keyPositions : nullptr;
+        uint64_t numValues = positions != nullptr ? positions->size() : selVector.getSelSize();
+        serializer.serializeValue(chunk.state->isFlat());
+        serializer.serializeValue(numValues);
+        for (auto& vector : chunk.vectors) {
+            for (auto i = 0u; i < numValues; i++) {
+                auto pos = positions != nullptr ? (*positions)[i] : selVector[i];
+                vector->getAsValue(pos)->serialize(serializer);
+            }
+        }
+    }
+}
+
+bool HashJoinProbe::readSpilledProbeInput(main::ClientContext* context) {
+    while (spilledProbeInputReader == nullptr || spilledProbeInputReader->finished()) {
+        // Spilled input of the previous partition is no longer needed.
+        spilledProbeInputReader.reset();
+        spilledProbeInputToRead.reset();
+        partitionHashTable.reset();
+        hashTable = sharedState->getHashTable();
+        if (nextPartitionIdxToProbe == spilledProbeInputs.size()) {
+            return false;
+        }
+        auto partitionIdx = nextPartitionIdxToProbe++;
+        if (spilledProbeInputs[partitionIdx] == nullptr) {
+            continue;
+        }
+        spilledProbeInputToRead = std::move(spilledProbeInputs[partitionIdx]);
+        spilledProbeInputReader = spilledProbeInputToRead->getDeserializer();
+        partitionHashTable = sharedState->getPartitionHashTable(partitionIdx, context);
+        hashTable = partitionHashTable.get();
+    }
+    auto& deserializer = *spilledProbeInputReader;
+    deserializer.deserializeValue(resultSet->multiplicity);
+    for (auto& chunk : probeSideChunks) {
+        bool isFlat = false;
+        uint64_t numValues = 0;
+        deserializer.deserializeValue(isFlat);
+        deserializer.deserializeValue(numValues);
+        if (isFlat) {
+            chunk.state->setToFlat();
+        } else {
+            chunk.state->setToUnflat();
+        }
+        chunk.state->getSelVectorUnsafe().setToUnfiltered(numValues);
+        for (auto& vector : chunk.vectors) {
+            vector->resetAuxiliaryBuffer();
+            for (auto i = 0u; i < numValues; i++) {
+                vector->copyFromValue(i, *Value::deserialize(deserializer));
+            }
+        }
+    }
+    return true;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -43,14 +177,14 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeInput(context)) {
             return false;
         }
         saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
+        hashTable->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
             probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
+    auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors,
         probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -61,14 +195,14 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(*keyVector->state);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextProbeInput(context)) {
         return false;
     }
     saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
+    hashTable->probe(keyVectors, hashVector.get(), tmpHashVector.get(),
         probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -80,7 +214,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -100,7 +234,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector.setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -198,5 +332,13 @@ bool HashJoinProbe::getNextTuplesInternal(ExecutionContext* context) {
     return true;
 }
 
+std::unordered_map<std::string, std::string> HashJoinProbe::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"SpilledTuples",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSpilledTuplesMetricKey()))});
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
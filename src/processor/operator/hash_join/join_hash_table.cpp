@@ -129,16 +129,15 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
     ValueVector* tmpHashVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
     if (getNumTuples() == 0) {
+        // Probed tuples may be left over from probing another table with the same probe state.
+        std::fill(probedTuples,
+            probedTuples + keyVectors[0]->state->getSelVector().getSelSize(), nullptr);
         return;
     }
     if (!discardNullFromKeys(keyVectors)) {
         return;
     }
-    function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
-    for (auto i = 1u; i < keyVectors.size(); i++) {
-        function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
-        function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
-    }
+    computeProbeHashes(keyVectors, hashVector, tmpHashVector);
     for (auto i = 0u; i < hashVector->state->getSelVector().getSelSize(); i++) {
         auto pos = hashVector->state->getSelVector()[i];
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
@@ -146,6 +145,15 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
     }
 }
 
+void JoinHashTable::computeProbeHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector* hashVector, ValueVector* tmpHashVector) {
+    function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
+    for (auto i = 1u; i < keyVectors.size(); i++) {
+        function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
+        function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
+    }
+}
+
 sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
     uint8_t** probedTuples, uint8_t** matchedTuples) {
     auto numMatchedTuples = 0;
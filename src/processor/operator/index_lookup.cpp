@@ -62,29 +62,16 @@ void IndexLookup::checkNullKeys(ValueVector* keyVector) {
     }
 }
 
-void stringPKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->getSelVector().getSelSize();
-    for (auto i = 0u; i < numKeys; i++) {
-        auto key = keyVector->getValue<ku_string_t>(keyVector->state->getSelVector()[i]);
-        if (!info.index->lookup(transaction, key.getAsStringView(), offsets[i])) {
-            throw RuntimeException(ExceptionMessage::nonExistentPKException(key.getAsString()));
-        }
-    }
-}
-
-template<HashablePrimitive T>
-void primitivePKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->getSelVector().getSelSize();
-    for (auto i = 0u; i < numKeys; i++) {
-        auto pos = keyVector->state->getSelVector()[i];
-        auto key = keyVector->getValue<T>(pos);
-        if (!info.index->lookup(transaction, key, offsets[i])) {
-            throw RuntimeException(
-                ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)));
-        }
-    }
+static std::string getPKString(PhysicalTypeID pkTypeID, ValueVector* keyVector, sel_t pos) {
+    std::string pkString;
+    TypeUtils::visit(
+        pkTypeID,
+        [&](ku_string_t) { pkString = keyVector->getValue<ku_string_t>(pos).getAsString(); },
+        [&]<HashablePrimitive T>(T) {
+            pkString = TypeUtils::toString(keyVector->getValue<T>(pos));
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    return pkString;
 }
 
 // TODO(Guodong): Add short path for unfiltered case.
@@ -92,23 +79,20 @@ void IndexLookup::fillOffsetArraysFromVector(transaction::Transaction* transacti
     const IndexLookupInfo& info, ValueVector* keyVector, ValueVector* resultVector) {
     KU_ASSERT(resultVector->dataType.getPhysicalType() == PhysicalTypeID::INT64);
     auto offsets = (offset_t*)resultVector->getData();
-    TypeUtils::visit(
-        info.pkDataType->getPhysicalType(),
-        [&](ku_string_t) {
-            stringPKFillOffsetArraysFromVector(transaction, info, keyVector, offsets);
-        },
-        [&]<HashablePrimitive T>(T) {
-            if (info.pkDataType->getLogicalTypeID() == LogicalTypeID::SERIAL) {
-                auto numKeys = keyVector->state->getSelVector().getSelSize();
-                for (auto i = 0u; i < numKeys; i++) {
-                    auto pos = keyVector->state->getSelVector()[i];
-                    offsets[i] = keyVector->getValue<int64_t>(pos);
-                }
-            } else {
-                primitivePKFillOffsetArraysFromVector<T>(transaction, info, keyVector, offsets);
-            }
-        },
-        [&](auto) { KU_UNREACHABLE; });
+    auto& selVector = keyVector->state->getSelVector();
+    if (info.pkDataType->getLogicalTypeID() == LogicalTypeID::SERIAL) {
+        for (auto i = 0u; i < selVector.getSelSize(); i++) {
+            offsets[i] = keyVector->getValue<int64_t>(selVector[i]);
+        }
+        return;
+    }
+    info.index->lookupBatch(transaction, keyVector, offsets);
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        if (offsets[i] == INVALID_OFFSET) {
+            throw RuntimeException(ExceptionMessage::nonExistentPKException(
+                getPKString(info.pkDataType->getPhysicalType(), keyVector, selVector[i])));
+        }
+    }
 }
 
 } // namespace processor
@@ -9,6 +9,7 @@ void IndexScan::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* c
     indexEvaluator->init(*resultSet, context->clientContext->getMemoryManager());
     indexVector = indexEvaluator->resultVector.get();
     outVector = resultSet->getValueVector(outDataPos).get();
+    nodeOffsets = std::make_unique<offset_t[]>(DEFAULT_VECTOR_CAPACITY);
 }
 
 bool IndexScan::getNextTuplesInternal(ExecutionContext* context) {
@@ -21,16 +22,15 @@ bool IndexScan::getNextTuplesInternal(ExecutionContext* context) {
         saveSelVector(*outVector->state);
         numSelectedValues = 0u;
         auto buffer = outVector->state->getSelVectorUnsafe().getMultableBuffer();
+        pkIndex->lookupBatch(context->clientContext->getTx(), indexVector, nodeOffsets.get());
         for (auto i = 0u; i < indexVector->state->getSelVector().getSelSize(); ++i) {
             auto pos = indexVector->state->getSelVector()[i];
-            if (indexVector->isNull(pos)) {
+            // Null keys are not found either.
+            if (nodeOffsets[i] == INVALID_OFFSET) {
                 continue;
             }
-            buffer[numSelectedValues] = pos;
-            offset_t nodeOffset = INVALID_OFFSET;
-            numSelectedValues +=
-                pkIndex->lookup(context->clientContext->getTx(), indexVector, pos, nodeOffset);
-            nodeID_t nodeID{nodeOffset, tableID};
+            buffer[numSelectedValues++] = pos;
+            nodeID_t nodeID{nodeOffsets[i], tableID};
             outVector->setValue<nodeID_t>(pos, nodeID);
         }
         if (!outVector->state->isFlat() && outVector->state->getSelVector().isUnfiltered()) {
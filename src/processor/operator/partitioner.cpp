@@ -2,7 +2,9 @@
 
 #include "common/constants.h"
 #include "common/data_chunk/sel_vector.h"
+#include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "storage/storage_utils.h"
 #include "storage/store/node_table.h"
 
 using namespace kuzu::common;
@@ -46,6 +48,15 @@ void PartitionerSharedState::initialize(std::vector<std::unique_ptr<Partitioning
     numPartitions[0] = getNumPartitions(maxNodeOffsets[0]);
     numPartitions[1] = getNumPartitions(maxNodeOffsets[1]);
     Partitioner::initializePartitioningStates(infos, partitioningBuffers, numPartitions);
+    if (memoryLimit > 0) {
+        spilledPartitions.resize(numPartitions.size());
+        for (auto partitioningIdx = 0u; partitioningIdx < numPartitions.size(); partitioningIdx++) {
+            spilledPartitions[partitioningIdx].resize(numPartitions[partitioningIdx]);
+            for (auto& partition : spilledPartitions[partitioningIdx]) {
+                partition = std::make_unique<SpilledPartition>();
+            }
+        }
+    }
 }
 
 partition_idx_t PartitionerSharedState::getNextPartition(vector_idx_t partitioningIdx) {
@@ -71,6 +82,99 @@ void PartitionerSharedState::merge(
     }
 }
 
+uint64_t PartitionerSharedState::spill(
+    std::vector<std::unique_ptr<PartitioningBuffer>>& localPartitioningStates,
+    main::ClientContext* context) {
+    KU_ASSERT(memoryLimit > 0 && spilledPartitions.size() == localPartitioningStates.size());
+    uint64_t numSpilledTuples = 0;
+    for (auto partitioningIdx = 0u; partitioningIdx < localPartitioningStates.size();
+         partitioningIdx++) {
+        auto& partitions = localPartitioningStates[partitioningIdx]->partitions;
+        auto& types = columnTypes[partitioningIdx];
+        std::vector<std::unique_ptr<ValueVector>> vectors;
+        for (auto& type : types) {
+            vectors.push_back(std::make_unique<ValueVector>(type, context->getMemoryManager()));
+        }
+        for (auto partitionIdx = 0u; partitionIdx < partitions.size(); partitionIdx++) {
+            auto& partition = partitions[partitionIdx];
+            if (partition.getNumChunkedGroups() == 0) {
+                continue;
+            }
+            auto& spilledPartition = *spilledPartitions[partitioningIdx][partitionIdx];
+            std::unique_lock lck{spilledPartition.mtx};
+            if (spilledPartition.file == nullptr) {
+                spilledPartition.file = std::make_unique<SpillFile>(context);
+            }
+            auto& serializer = spilledPartition.file->getSerializer();
+            for (auto& chunkedGroup : partition.getChunkedGroups()) {
+                uint64_t numRows = chunkedGroup->getNumRows();
+                if (numRows == 0) {
+                    continue;
+                }
+                serializer.write(numRows);
+                for (auto columnIdx = 0u; columnIdx < types.size(); columnIdx++) {
+                    auto& chunk = chunkedGroup->getColumnChunk(columnIdx);
+                    auto& vector = *vectors[columnIdx];
+                    vector.resetAuxiliaryBuffer();
+                    for (auto i = 0u; i < numRows; i++) {
+                        chunk.lookup(i, vector, 0 /* posInOutputVector */);
+                        vector.getAsValue(0)->serialize(serializer);
+                    }
+                }
+                spilledPartition.numTuples += numRows;
+                numSpilledTuples += numRows;
+            }
+            partition.clear();
+        }
+    }
+    return numSpilledTuples;
+}
+
+void PartitionerSharedState::loadSpilledPartition(vector_idx_t partitioningIdx,
+    partition_idx_t partitionIdx, main::ClientContext* context) {
+    if (spilledPartitions.empty()) {
+        return;
+    }
+    auto& spilledPartition = *spilledPartitions[partitioningIdx][partitionIdx];
+    if (spilledPartition.numTuples == 0) {
+        return;
+    }
+    auto& partition = partitioningBuffers[partitioningIdx]->partitions[partitionIdx];
+    auto state = std::make_shared<DataChunkState>();
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    std::vector<ValueVector*> vectorsToAppend;
+    for (auto& type : columnTypes[partitioningIdx]) {
+        auto vector = std::make_unique<ValueVector>(type, context->getMemoryManager());
+        vector->setState(state);
+        vectorsToAppend.push_back(vector.get());
+        vectors.push_back(std::move(vector));
+    }
+    auto deserializer = spilledPartition.file->getDeserializer();
+    uint64_t numReadTuples = 0;
+    while (numReadTuples < spilledPartition.numTuples) {
+        uint64_t numRows = 0;
+        deserializer->deserializeValue(numRows);
+        // Each batch is a spilled chunked group, which holds at most CHUNK_CAPACITY tuples.
+        KU_ASSERT(numRows <= DEFAULT_VECTOR_CAPACITY);
+        for (auto& vector : vectors) {
+            vector->resetAuxiliaryBuffer();
+            for (auto i = 0u; i < numRows; i++) {
+                vector->copyFromValue(i, *Value::deserialize(*deserializer));
+            }
+        }
+        state->initOriginalAndSelectedSize(numRows);
+        partition.append(vectorsToAppend, state->getSelVector());
+        numReadTuples += numRows;
+    }
+    spilledPartition.file.reset();
+    spilledPartition.numTuples = 0;
+}
+
+void PartitionerSharedState::releasePartition(vector_idx_t partitioningIdx,
+    partition_idx_t partitionIdx) {
+    partitioningBuffers[partitioningIdx]->partitions[partitionIdx].clear();
+}
+
 void PartitioningBuffer::merge(std::unique_ptr<PartitioningBuffer> localPartitioningState) {
     KU_ASSERT(partitions.size() == localPartitioningState->partitions.size());
     for (auto partitionIdx = 0u; partitionIdx < partitions.size(); partitionIdx++) {
@@ -86,7 +190,7 @@ Partitioner::Partitioner(std::unique_ptr<ResultSetDescriptor> resultSetDescripto
     uint32_t id, const std::string& paramsString)
     : Sink{std::move(resultSetDescriptor), PhysicalOperatorType::PARTITIONER, std::move(child), id,
           paramsString},
-      infos{std::move(infos)}, sharedState{std::move(sharedState)} {
+      infos{std::move(infos)}, sharedState{std::move(sharedState)}, spilledTuples{nullptr} {
     partitionIdxes = std::make_unique<ValueVector>(LogicalTypeID::INT64);
 }
 
@@ -94,10 +198,16 @@ void Partitioner::initGlobalStateInternal(ExecutionContext* /*context*/) {
     sharedState->initialize(infos);
 }
 
-void Partitioner::initLocalStateInternal(ResultSet* /*resultSet*/, ExecutionContext* /*context*/) {
+void Partitioner::initLocalStateInternal(ResultSet* /*resultSet*/, ExecutionContext* context) {
     localState = std::make_unique<PartitionerLocalState>();
     initializePartitioningStates(infos, localState->partitioningBuffers,
         sharedState->numPartitions);
+    if (sharedState->memoryLimit > 0) {
+        auto numThreads = context->clientConfig.numThreads;
+        localState->memoryLimit = std::max<uint64_t>(
+            sharedState->memoryLimit / std::max<uint64_t>(numThreads, 1), 1);
+    }
+    spilledTuples = context->profiler->registerNumericMetric(getSpilledTuplesMetricKey());
 }
 
 DataChunk Partitioner::constructDataChunk(const std::vector<DataPos>& columnPositions,
@@ -144,10 +254,33 @@ void Partitioner::executeInternal(ExecutionContext* context) {
                 *resultSet, keyVector->state);
             copyDataToPartitions(partitioningIdx, std::move(chunkToCopyFrom));
         }
+        if (localState->memoryLimit > 0 && getLocalMemoryUsage() > localState->memoryLimit) {
+            spilledTuples->increase(
+                sharedState->spill(localState->partitioningBuffers, context->clientContext));
+        }
     }
     sharedState->merge(std::move(localState->partitioningBuffers));
 }
 
+uint64_t Partitioner::getLocalMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto partitioningIdx = 0u; partitioningIdx < infos.size(); partitioningIdx++) {
+        // Chunked groups are allocated with their full capacity. The estimate ignores overflow
+        // data of strings and lists.
+        uint64_t numBytesPerRow = 0;
+        for (auto& type : infos[partitioningIdx]->columnTypes) {
+            numBytesPerRow += StorageUtils::getDataTypeSize(type);
+        }
+        uint64_t numChunkedGroups = 0;
+        for (auto& partition : localState->partitioningBuffers[partitioningIdx]->partitions) {
+            numChunkedGroups += partition.getNumChunkedGroups();
+        }
+        memoryUsage +=
+            numChunkedGroups * ChunkedNodeGroupCollection::CHUNK_CAPACITY * numBytesPerRow;
+    }
+    return memoryUsage;
+}
+
 void Partitioner::copyDataToPartitions(partition_idx_t partitioningIdx, DataChunk chunkToCopyFrom) {
     std::vector<ValueVector*> vectorsToAppend;
     vectorsToAppend.reserve(chunkToCopyFrom.getNumValueVectors());
@@ -168,6 +301,14 @@ void Partitioner::copyDataToPartitions(partition_idx_t partitioningIdx, DataChun
     }
 }
 
+std::unordered_map<std::string, std::string> Partitioner::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"SpilledTuples",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSpilledTuplesMetricKey()))});
+    return result;
+}
+
 std::unique_ptr<PhysicalOperator> Partitioner::clone() {
     auto copiedInfos = PartitioningInfo::copy(infos);
     return std::make_unique<Partitioner>(resultSetDescriptor->copy(), std::move(copiedInfos),
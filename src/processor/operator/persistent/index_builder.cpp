@@ -33,11 +33,20 @@ void IndexBuilderGlobalQueues::maybeConsumeIndex(size_t index) {
     if (!mutexes[index].try_lock()) {
         return;
     }
+    std::unique_lock lck{mutexes[index], std::adopt_lock};
+    consumeIndexNoLock(index);
+}
+
+void IndexBuilderGlobalQueues::consumeAndMergeIndex(size_t index) {
+    std::unique_lock lck{mutexes[index]};
+    consumeIndexNoLock(index);
+    pkIndex->mergeLocalStorage(index);
+}
 
+void IndexBuilderGlobalQueues::consumeIndexNoLock(size_t index) {
     std::visit(
         [&](auto&& queues) {
             using T = std::decay_t<decltype(queues.type)>;
-            std::unique_lock lck{mutexes[index], std::adopt_lock};
             IndexBuffer<T> buffer;
             while (queues.array[index].pop(buffer)) {
                 auto numValuesInserted = pkIndex->appendWithIndexPos(buffer, index);
@@ -82,6 +91,16 @@ void IndexBuilderLocalBuffers::flush() {
 IndexBuilder::IndexBuilder(std::shared_ptr<IndexBuilderSharedState> sharedState)
     : sharedState(std::move(sharedState)), localBuffers(this->sharedState->globalQueues) {}
 
+void IndexBuilderSharedState::merge() {
+    while (true) {
+        auto index = nextIndexToMerge.fetch_add(1, std::memory_order_relaxed);
+        if (index >= NUM_HASH_INDEXES) {
+            return;
+        }
+        globalQueues.consumeAndMergeIndex(index);
+    }
+}
+
 void IndexBuilderSharedState::quitProducer() {
     if (producers.fetch_sub(1, std::memory_order_relaxed) == 1) {
         done.store(true, std::memory_order_relaxed);
@@ -31,7 +31,8 @@ void NodeBatchInsertSharedState::initPKIndex(ExecutionContext*) {
         numRows = scanSharedState->getNumRows();
     } else {
         KU_ASSERT(distinctSharedState);
-        numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+        // Reserving for an upper bound avoids merging the distinct keys before the copy starts.
+        numRows = distinctSharedState->getNumEntriesUpperBound();
     }
     pkIndex->bulkReserve(numRows);
     globalIndexBuilder = IndexBuilder(std::make_shared<IndexBuilderSharedState>(pkIndex));
@@ -77,7 +78,7 @@ void NodeBatchInsert::initGlobalStateInternal(ExecutionContext* context) {
     }
 }
 
-void NodeBatchInsert::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
+void NodeBatchInsert::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     std::shared_ptr<DataChunkState> state;
     auto nodeInfo = ku_dynamic_cast<BatchInsertInfo*, NodeBatchInsertInfo*>(info.get());
     for (auto& pos : nodeInfo->columnPositions) {
@@ -114,6 +115,8 @@ void NodeBatchInsert::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
     nodeLocalState->nodeGroup = NodeGroupFactory::createNodeGroup(ColumnDataFormat::REGULAR,
         nodeInfo->columnTypes, info->compressionEnabled);
     nodeLocalState->columnState = state.get();
+    indexBuildTime = context->profiler->registerTimeMetric(getIndexBuildTimeMetricKey());
+    indexMergeTime = context->profiler->registerTimeMetric(getIndexMergeTimeMetricKey());
 }
 
 void NodeBatchInsert::executeInternal(ExecutionContext* context) {
@@ -136,7 +139,14 @@ void NodeBatchInsert::executeInternal(ExecutionContext* context) {
     if (nodeLocalState->localIndexBuilder) {
         KU_ASSERT(token);
         token->quit();
+        indexBuildTime->start();
         nodeLocalState->localIndexBuilder->finishedProducing();
+        indexBuildTime->stop();
+        // Write this thread's share of the hash indexes to disk while other threads are still
+        // copying. Keys of the last incomplete node group are appended later during finalize.
+        indexMergeTime->start();
+        nodeLocalState->localIndexBuilder->merge();
+        indexMergeTime->stop();
     }
 }
 
@@ -238,7 +248,11 @@ void NodeBatchInsert::finalize(ExecutionContext* context) {
         }
     }
     if (nodeSharedState->globalIndexBuilder) {
+        auto indexFlushTime =
+            context->profiler->registerTimeMetric(getIndexFlushTimeMetricKey());
+        indexFlushTime->start();
         nodeSharedState->globalIndexBuilder->finalize(context);
+        indexFlushTime->stop();
     }
     sharedState->logBatchInsertWALRecord();
     auto outputMsg = stringFormat("{} tuples have been copied to the {} table.",
@@ -246,5 +260,22 @@ void NodeBatchInsert::finalize(ExecutionContext* context) {
     FactorizedTableUtils::appendStringToTable(sharedState->fTable.get(), outputMsg,
         context->clientContext->getMemoryManager());
 }
+
+std::unordered_map<std::string, std::string> NodeBatchInsert::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    auto nodeSharedState =
+        ku_dynamic_cast<BatchInsertSharedState*, NodeBatchInsertSharedState*>(sharedState.get());
+    if (nodeSharedState->globalIndexBuilder) {
+        result.insert({"IndexBuildTime",
+            std::to_string(profiler.sumAllTimeMetricsWithKey(getIndexBuildTimeMetricKey()))});
+        result.insert({"IndexMergeTime",
+            std::to_string(profiler.sumAllTimeMetricsWithKey(getIndexMergeTimeMetricKey()))});
+        result.insert({"IndexFlushTime",
+            std::to_string(profiler.sumAllTimeMetricsWithKey(getIndexFlushTimeMetricKey()))});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
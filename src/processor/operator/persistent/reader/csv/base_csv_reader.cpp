@@ -2,6 +2,8 @@
 
 #include <fcntl.h>
 
+#include <bit>
+#include <cstring>
 #include <vector>
 
 #include "common/exception/copy.h"
@@ -207,6 +209,38 @@ bool BaseCSVReader::readBuffer(uint64_t* start) {
     return readCount > 0;
 }
 
+static constexpr uint64_t SWAR_ONES = 0x0101010101010101;
+static constexpr uint64_t SWAR_HIGH_BITS = 0x8080808080808080;
+
+// Sets the high bit of each byte of word which equals c. Bits above the lowest one that is set may
+// be false positives.
+static inline uint64_t getByteMatches(uint64_t word, char c) {
+    auto diff = word ^ (SWAR_ONES * static_cast<uint8_t>(c));
+    return (diff - SWAR_ONES) & ~diff & SWAR_HIGH_BITS;
+}
+
+// Most characters of a CSV file are not structural, so 8 bytes are compared at a time.
+uint64_t BaseCSVReader::findFirstOf(const char* buffer, uint64_t position, uint64_t end, char c1,
+    char c2, char c3) {
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; position + sizeof(uint64_t) <= end; position += sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, buffer + position, sizeof(uint64_t));
+            auto matches =
+                getByteMatches(word, c1) | getByteMatches(word, c2) | getByteMatches(word, c3);
+            if (matches != 0) {
+                return position + std::countr_zero(matches) / 8;
+            }
+        }
+    }
+    for (; position < end; position++) {
+        if (buffer[position] == c1 || buffer[position] == c2 || buffer[position] == c3) {
+            return position;
+        }
+    }
+    return end;
+}
+
 template<typename Driver>
 uint64_t BaseCSVReader::parseCSV(Driver& driver) {
     // used for parsing algorithm
@@ -244,11 +278,12 @@ normal:
     // this state parses the remainder of a non-quoted value until we reach a delimiter or
     // newline
     do {
-        for (; position < bufferSize; position++) {
+        position = findFirstOf(buffer.get(), position, bufferSize, option.delimiter, '\n', '\r');
+        if (position < bufferSize) {
             if (buffer[position] == option.delimiter) {
                 // delimiter: end the value and add it to the chunk
                 goto add_value;
-            } else if (isNewLine(buffer[position])) {
+            } else {
                 // newline: add row
                 goto add_row;
             }
@@ -308,16 +343,16 @@ in_quotes:
     // this state parses the remainder of a quoted value.
     position++;
     do {
-        for (; position < bufferSize; position++) {
+        position = findFirstOf(buffer.get(), position, bufferSize, option.quoteChar,
+            option.escapeChar, option.escapeChar);
+        if (position < bufferSize) {
             if (buffer[position] == option.quoteChar) {
                 // quote: move to unquoted state
                 goto unquote;
-            } else if (buffer[position] == option.escapeChar) {
+            } else {
                 // escape: store the escaped position and move to handle_escape state
                 escapePositions.push_back(position - start);
                 goto handle_escape;
-            } else if (isNewLine(buffer[position])) {
-                [[unlikely]] handleQuotedNewline();
             }
         }
     } while (readBuffer(&start));
@@ -19,9 +19,64 @@ using namespace kuzu::function;
 namespace kuzu {
 namespace processor {
 
+void CSVBlockStartStates::setBlockTransitions(block_idx_t blockIdx,
+    const csv_block_transitions_t& transitions) {
+    {
+        std::lock_guard<std::mutex> guard{mtx};
+        if (blockTransitions.size() <= blockIdx) {
+            blockTransitions.resize(blockIdx + 1);
+        }
+        blockTransitions[blockIdx] = transitions;
+    }
+    cv.notify_all();
+}
+
+CSVQuoteState CSVBlockStartStates::getBlockStartState(block_idx_t blockIdx) {
+    std::unique_lock lck{mtx};
+    while (startStates.size() <= blockIdx) {
+        auto prevBlockIdx = startStates.size() - 1;
+        cv.wait(lck, [&] {
+            return prevBlockIdx < blockTransitions.size() &&
+                   blockTransitions[prevBlockIdx].has_value();
+        });
+        auto prevStartState = static_cast<uint8_t>(startStates[prevBlockIdx]);
+        startStates.push_back((*blockTransitions[prevBlockIdx])[prevStartState]);
+    }
+    return startStates[blockIdx];
+}
+
 ParallelCSVReader::ParallelCSVReader(const std::string& filePath, CSVOption option,
-    uint64_t numColumns, main::ClientContext* context)
-    : BaseCSVReader{filePath, std::move(option), numColumns, context} {}
+    uint64_t numColumns, main::ClientContext* context, CSVBlockStartStates* blockStartStates)
+    : BaseCSVReader{filePath, std::move(option), numColumns, context},
+      blockStartStates{blockStartStates} {
+    // Follows the states of BaseCSVReader::parseCSV. Characters which are invalid in a state make
+    // parsing fail anyway, so their transitions do not matter.
+    auto quoteChar = this->option.quoteChar;
+    auto escapeChar = this->option.escapeChar;
+    auto canEscapeQuote = !escapeChar || escapeChar == quoteChar;
+    for (auto i = 0u; i < 256; i++) {
+        auto c = static_cast<char>(i);
+        auto endsValue = c == this->option.delimiter || isNewLine(c);
+        auto endsQuotedValue = endsValue || c == CopyConstants::DEFAULT_CSV_LIST_END_CHAR;
+        auto getTransition = [&](CSVQuoteState state) -> CSVQuoteState& {
+            return quoteStateTransitions[static_cast<uint8_t>(state)][i];
+        };
+        getTransition(CSVQuoteState::VALUE_START) =
+            c == quoteChar ? CSVQuoteState::IN_QUOTES :
+            endsValue      ? CSVQuoteState::VALUE_START :
+                             CSVQuoteState::UNQUOTED_VALUE;
+        getTransition(CSVQuoteState::UNQUOTED_VALUE) =
+            endsValue ? CSVQuoteState::VALUE_START : CSVQuoteState::UNQUOTED_VALUE;
+        getTransition(CSVQuoteState::IN_QUOTES) = c == quoteChar  ? CSVQuoteState::UNQUOTE :
+                                                  c == escapeChar ? CSVQuoteState::ESCAPE :
+                                                                    CSVQuoteState::IN_QUOTES;
+        getTransition(CSVQuoteState::ESCAPE) = CSVQuoteState::IN_QUOTES;
+        getTransition(CSVQuoteState::UNQUOTE) =
+            c == quoteChar && canEscapeQuote ? CSVQuoteState::IN_QUOTES :
+            endsQuotedValue                  ? CSVQuoteState::VALUE_START :
+                                               CSVQuoteState::UNQUOTED_VALUE;
+    }
+}
 
 bool ParallelCSVReader::hasMoreToRead() const {
     // If we haven't started the first block yet or are done our block, get the next block.
@@ -60,23 +115,23 @@ void ParallelCSVReader::seekToBlockStart() {
     }
     osFileOffset = currentBlockIdx * CopyConstants::PARALLEL_BLOCK_SIZE;
 
-    if (currentBlockIdx == 0) {
-        // First block doesn't search for a newline.
-        return;
-    }
-
     // Reset the buffer.
     position = 0;
     bufferSize = 0;
     buffer.reset();
-    if (!readBuffer(nullptr)) {
+    setBlockTransitions();
+    if (currentBlockIdx == 0 || bufferSize == 0) {
+        // First block doesn't search for a newline.
         return;
     }
 
-    // Find the start of the next line.
+    // Find the start of the next line, skipping newlines in quoted values.
+    auto state = blockStartStates->getBlockStartState(currentBlockIdx);
     do {
         for (; position < bufferSize; position++) {
-            if (buffer[position] == '\r') {
+            if (state == CSVQuoteState::IN_QUOTES || state == CSVQuoteState::ESCAPE) {
+                state = getNextQuoteState(state, buffer[position]);
+            } else if (buffer[position] == '\r') {
                 position++;
                 if (!maybeReadBuffer(nullptr)) {
                     return;
@@ -88,16 +143,54 @@ void ParallelCSVReader::seekToBlockStart() {
             } else if (buffer[position] == '\n') {
                 position++;
                 return;
+            } else {
+                state = getNextQuoteState(state, buffer[position]);
             }
         }
     } while (readBuffer(nullptr));
 }
 
-void ParallelCSVReader::handleQuotedNewline() {
-    throw CopyException(stringFormat("Quoted newlines are not supported in parallel CSV reader "
-                                     "(while parsing {} on line {}). Please "
-                                     "specify PARALLEL=FALSE in the options.",
-        fileInfo->path, getLineNumber()));
+void ParallelCSVReader::setBlockTransitions() {
+    csv_block_transitions_t transitions;
+    try {
+        transitions = computeBlockTransitions();
+    } catch (std::exception&) {
+        // Unblock readers of later blocks. The scan fails with this exception anyway.
+        for (auto i = 0u; i < NUM_CSV_QUOTE_STATES; i++) {
+            transitions[i] = static_cast<CSVQuoteState>(i);
+        }
+        blockStartStates->setBlockTransitions(currentBlockIdx, transitions);
+        throw;
+    }
+    blockStartStates->setBlockTransitions(currentBlockIdx, transitions);
+}
+
+// The block is scanned in the buffer that is then parsed, so it is only read from the file once.
+csv_block_transitions_t ParallelCSVReader::computeBlockTransitions() {
+    csv_block_transitions_t transitions;
+    for (auto i = 0u; i < NUM_CSV_QUOTE_STATES; i++) {
+        transitions[i] = static_cast<CSVQuoteState>(i);
+    }
+    if (!readBuffer(nullptr)) {
+        return transitions;
+    }
+    // A buffer is larger than a block, unless the file was read only partially.
+    uint64_t start = 0;
+    while (bufferSize < CopyConstants::PARALLEL_BLOCK_SIZE && readBuffer(&start)) {}
+    position = 0;
+    auto blockSize = std::min(CopyConstants::PARALLEL_BLOCK_SIZE, bufferSize);
+    uint64_t pos = 0;
+    // The first block is parsed after its BOM.
+    if (currentBlockIdx == 0 && blockSize >= 3 && buffer[0] == '\xEF' && buffer[1] == '\xBB' &&
+        buffer[2] == '\xBF') {
+        pos = 3;
+    }
+    for (; pos < blockSize; pos++) {
+        for (auto& state : transitions) {
+            state = getNextQuoteState(state, buffer[pos]);
+        }
+    }
+    return transitions;
 }
 
 bool ParallelCSVReader::finishedBlock() const {
@@ -139,7 +232,8 @@ static offset_t tableFunc(TableFuncInput& input, TableFuncOutput& output) {
             parallelCSVLocalState->reader = std::make_unique<ParallelCSVReader>(
                 parallelCSVSharedState->readerConfig.filePaths[fileIdx],
                 parallelCSVSharedState->csvReaderConfig.option.copy(),
-                parallelCSVSharedState->numColumns, parallelCSVSharedState->context);
+                parallelCSVSharedState->numColumns, parallelCSVSharedState->context,
+                parallelCSVSharedState->blockStartStates[fileIdx].get());
         }
         auto numRowsRead = parallelCSVLocalState->reader->parseBlock(blockIdx, outputChunk);
         outputChunk.state->getSelVectorUnsafe().setSelSize(numRowsRead);
@@ -174,9 +268,10 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(TableFunctionInitIn
     auto sharedState = std::make_unique<ParallelCSVScanSharedState>(bindData->config.copy(),
         numRows, bindData->columnNames.size(), bindData->context, csvConfig.copy());
     for (auto filePath : sharedState->readerConfig.filePaths) {
+        sharedState->blockStartStates.push_back(std::make_unique<CSVBlockStartStates>());
         auto reader = std::make_unique<ParallelCSVReader>(filePath,
             sharedState->csvReaderConfig.option.copy(), sharedState->numColumns,
-            sharedState->context);
+            sharedState->context, sharedState->blockStartStates.back().get());
         sharedState->totalSize += reader->getFileSize();
     }
     return sharedState;
@@ -187,7 +282,8 @@ static std::unique_ptr<TableFuncLocalState> initLocalState(TableFunctionInitInpu
     auto localState = std::make_unique<ParallelCSVLocalState>();
     auto sharedState = ku_dynamic_cast<TableFuncSharedState*, ParallelCSVScanSharedState*>(state);
     localState->reader = std::make_unique<ParallelCSVReader>(sharedState->readerConfig.filePaths[0],
-        sharedState->csvReaderConfig.option.copy(), sharedState->numColumns, sharedState->context);
+        sharedState->csvReaderConfig.option.copy(), sharedState->numColumns, sharedState->context,
+        sharedState->blockStartStates[0].get());
     localState->fileIdx = 0;
     return localState;
 }
@@ -8,6 +8,7 @@
 #include "common/string_format.h"
 #include "function/table/bind_data.h"
 #include "processor/operator/persistent/reader/parquet/list_column_reader.h"
+#include "processor/operator/persistent/reader/parquet/parquet_timestamp.h"
 #include "processor/operator/persistent/reader/parquet/struct_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/thrift_tools.h"
 #include "processor/operator/persistent/reader/reader_bind_utils.h"
@@ -215,6 +216,154 @@ void ParquetReader::initMetadata() {
     metadata->read(proto.get());
 }
 
+template<typename T>
+static std::optional<T> readPlainValue(const std::string& stat) {
+    if (stat.size() != sizeof(T)) {
+        return std::nullopt;
+    }
+    T value;
+    memcpy(&value, stat.data(), sizeof(T));
+    return value;
+}
+
+template<typename T>
+static std::optional<storage::StorageValue> readStorageValue(const std::string& stat,
+    const SchemaElement& schema, Type::type physicalType) {
+    if (schema.type != physicalType) {
+        return std::nullopt;
+    }
+    auto value = readPlainValue<T>(stat);
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    return storage::StorageValue(*value);
+}
+
+static std::optional<storage::StorageValue> readTimestampStorageValue(const std::string& stat,
+    const SchemaElement& schema) {
+    auto rawTS = readPlainValue<int64_t>(stat);
+    if (schema.type != Type::INT64 || !rawTS.has_value()) {
+        return std::nullopt;
+    }
+    std::optional<timestamp_t> ts;
+    if (schema.__isset.logicalType && schema.logicalType.__isset.TIMESTAMP) {
+        auto& unit = schema.logicalType.TIMESTAMP.unit;
+        if (unit.__isset.MILLIS) {
+            ts = ParquetTimeStampUtils::parquetTimestampMsToTimestamp(*rawTS);
+        } else if (unit.__isset.MICROS) {
+            ts = ParquetTimeStampUtils::parquetTimestampMicrosToTimestamp(*rawTS);
+        } else if (unit.__isset.NANOS) {
+            ts = ParquetTimeStampUtils::parquetTimestampNsToTimestamp(*rawTS);
+        }
+    } else if (schema.__isset.converted_type) {
+        if (schema.converted_type == ConvertedType::TIMESTAMP_MICROS) {
+            ts = ParquetTimeStampUtils::parquetTimestampMicrosToTimestamp(*rawTS);
+        } else if (schema.converted_type == ConvertedType::TIMESTAMP_MILLIS) {
+            ts = ParquetTimeStampUtils::parquetTimestampMsToTimestamp(*rawTS);
+        }
+    }
+    if (!ts.has_value()) {
+        return std::nullopt;
+    }
+    return storage::StorageValue(ts->value);
+}
+
+// Decodes a plain encoded min/max statistic into the value that column predicates compare against,
+// i.e. the value as it is stored in a vector of the given type.
+static std::optional<storage::StorageValue> readStatistic(const std::string& stat,
+    const SchemaElement& schema, const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::DATE:
+        return readStorageValue<int32_t>(stat, schema, Type::INT32);
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+        return readStorageValue<uint32_t>(stat, schema, Type::INT32);
+    case LogicalTypeID::INT64:
+        return readStorageValue<int64_t>(stat, schema, Type::INT64);
+    case LogicalTypeID::UINT64:
+        return readStorageValue<uint64_t>(stat, schema, Type::INT64);
+    case LogicalTypeID::FLOAT:
+        return readStorageValue<float>(stat, schema, Type::FLOAT);
+    case LogicalTypeID::DOUBLE:
+        return readStorageValue<double>(stat, schema, Type::DOUBLE);
+    case LogicalTypeID::TIMESTAMP:
+        return readTimestampStorageValue(stat, schema);
+    default:
+        return std::nullopt;
+    }
+}
+
+static bool isUnsigned(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Moves schemaIdx past the schema subtree rooted at schemaIdx. Returns the number of leaves of the
+// subtree, i.e. the number of column chunks it has in each row group.
+static uint64_t skipSchemaSubtree(const std::vector<SchemaElement>& schema, uint64_t& schemaIdx) {
+    auto& sEle = schema[schemaIdx++];
+    if (!sEle.__isset.num_children || sEle.num_children == 0) {
+        return 1;
+    }
+    uint64_t numLeaves = 0;
+    for (auto i = 0; i < sEle.num_children; i++) {
+        numLeaves += skipSchemaSubtree(schema, schemaIdx);
+    }
+    return numLeaves;
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<std::vector<storage::ColumnPredicate>>& columnPredicates) const {
+    auto& group = metadata->row_groups[groupIdx];
+    auto& schema = metadata->schema;
+    uint64_t schemaIdx = 1;
+    uint64_t chunkIdx = 0;
+    auto numColumns = std::min<uint64_t>(getNumColumns(), columnPredicates.size());
+    for (auto colIdx = 0u; colIdx < numColumns; colIdx++) {
+        auto& sEle = schema[schemaIdx];
+        auto columnChunkIdx = chunkIdx;
+        chunkIdx += skipSchemaSubtree(schema, schemaIdx);
+        if (columnPredicates[colIdx].empty() || columnChunkIdx >= group.columns.size()) {
+            continue;
+        }
+        auto& metaData = group.columns[columnChunkIdx].meta_data;
+        if (!metaData.__isset.statistics) {
+            continue;
+        }
+        auto& stats = metaData.statistics;
+        auto& type = *columnTypes[colIdx];
+        std::optional<storage::StorageValue> min, max;
+        if (stats.__isset.min_value && stats.__isset.max_value) {
+            min = readStatistic(stats.min_value, sEle, type);
+            max = readStatistic(stats.max_value, sEle, type);
+        } else if (stats.__isset.min && stats.__isset.max && !isUnsigned(type)) {
+            // Deprecated min/max are computed with signed comparison.
+            min = readStatistic(stats.min, sEle, type);
+            max = readStatistic(stats.max, sEle, type);
+        }
+        if (!min.has_value() || !max.has_value()) {
+            continue;
+        }
+        for (auto& predicate : columnPredicates[colIdx]) {
+            if (predicate.canSkip(*min, *max, type.getPhysicalType())) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<ColumnReader> ParquetReader::createReaderRecursive(uint64_t depth,
     uint64_t maxDefine, uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx) {
     KU_ASSERT(nextSchemaIdx < metadata->schema.size());
@@ -565,8 +714,10 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
 }
 
 ParquetScanSharedState::ParquetScanSharedState(common::ReaderConfig readerConfig, uint64_t numRows,
-    main::ClientContext* context)
-    : ScanFileSharedState{std::move(readerConfig), numRows, context} {
+    main::ClientContext* context,
+    std::vector<std::vector<storage::ColumnPredicate>> columnPredicates)
+    : ScanFileSharedState{std::move(readerConfig), numRows, context},
+      columnPredicates{std::move(columnPredicates)} {
     readers.push_back(
         std::make_unique<ParquetReader>(this->readerConfig.filePaths[fileIdx], context));
     totalRowsGroups = 0;
@@ -585,6 +736,11 @@ static bool parquetSharedStateNext(ParquetScanLocalState& localState,
             return false;
         }
         if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
+            if (sharedState.readers[sharedState.fileIdx]->canSkipRowGroup(sharedState.blockIdx,
+                    sharedState.columnPredicates)) {
+                sharedState.blockIdx++;
+                continue;
+            }
             localState.reader = sharedState.readers[sharedState.fileIdx].get();
             localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
                 sharedState.context->getVFSUnsafe());
@@ -680,7 +836,7 @@ static std::unique_ptr<function::TableFuncSharedState> initSharedState(
         numRows += reader->getMetadata()->num_rows;
     }
     return std::make_unique<ParquetScanSharedState>(parquetScanBindData->config.copy(), numRows,
-        parquetScanBindData->context);
+        parquetScanBindData->context, parquetScanBindData->columnPredicates);
 }
 
 static std::unique_ptr<function::TableFuncLocalState> initLocalState(
@@ -38,6 +38,8 @@ void RelBatchInsert::executeInternal(ExecutionContext* context) {
             // No more partitions left in the partitioning buffer.
             break;
         }
+        partitionerSharedState->loadSpilledPartition(relInfo->partitioningIdx,
+            relLocalState->nodeGroupIdx, context->clientContext);
         if (relTable->isNewNodeGroup(context->clientContext->getTx(), relLocalState->nodeGroupIdx,
                 relInfo->direction)) {
             appendNewNodeGroup(context->clientContext->getTx(), *relInfo, *relLocalState,
@@ -46,6 +48,8 @@ void RelBatchInsert::executeInternal(ExecutionContext* context) {
             mergeNodeGroup(context->clientContext->getTx(), *relInfo, *relLocalState, *sharedState,
                 *partitionerSharedState);
         }
+        partitionerSharedState->releasePartition(relInfo->partitioningIdx,
+            relLocalState->nodeGroupIdx);
     }
 }
 
@@ -47,6 +47,12 @@ void BaseFrontierScanner::resetState(const BaseBFSState& bfsState) {
     }
 }
 
+void BaseFrontierScanner::resetState(const std::vector<Frontier*>& frontiers_) {
+    lastFrontierCursor = 0;
+    currentDstNodeID = {INVALID_OFFSET, INVALID_TABLE_ID};
+    frontiers = frontiers_;
+}
+
 bool PathScanner::trailSemanticCheck(const std::vector<nodeID_t>&,
     const std::vector<relID_t>& edgeIDs) {
     common::rel_id_set_t set;
@@ -177,7 +183,6 @@ void PathScanner::writePathToVector(RecursiveJoinVectors* vectors, sel_t& vector
 
 void DstNodeWithMultiplicityScanner::scanFromDstOffset(RecursiveJoinVectors* vectors,
     sel_t& vectorPos, sel_t&, sel_t&) {
-    auto& multiplicity = frontiers[k]->nodeIDToMultiplicity.at(currentDstNodeID);
     while (multiplicity > 0 && vectorPos < DEFAULT_VECTOR_CAPACITY) {
         writeDstNodeOffsetAndLength(vectors->dstNodeIDVector, vectors->pathLengthVector, vectorPos);
         vectorPos++;
@@ -0,0 +1,245 @@
+#include "processor/operator/recursive_extend/multi_source_bfs.h"
+
+#include <bit>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+std::vector<Frontier*> MultiSourceBFSResult::getFrontiers(uint32_t lane) const {
+    std::vector<Frontier*> result;
+    for (auto& frontier : laneFrontiers[lane]) {
+        result.push_back(frontier.get());
+    }
+    return result;
+}
+
+static lane_mask_t getLaneMask(uint32_t lane) {
+    return (lane_mask_t)1 << lane;
+}
+
+// Mask of the first numLanes lanes.
+static lane_mask_t getLanesMask(uint64_t numLanes) {
+    return numLanes == MULTI_SOURCE_BFS_NUM_LANES ? ~(lane_mask_t)0 : getLaneMask(numLanes) - 1;
+}
+
+template<typename FUNC>
+static void forEachLane(lane_mask_t lanes, FUNC func) {
+    while (lanes != 0) {
+        auto lane = (uint32_t)std::countr_zero(lanes);
+        func(lane);
+        lanes &= lanes - 1;
+    }
+}
+
+void MultiSourceBFSState::resetState(const std::vector<nodeID_t>& srcNodeIDs) {
+    KU_ASSERT(!srcNodeIDs.empty() && srcNodeIDs.size() <= MULTI_SOURCE_BFS_NUM_LANES);
+    currentLevel = 0;
+    nextNodeIdxToExtend = 0;
+    currentFrontier.resetState();
+    nextFrontier.resetState();
+    visited.clear();
+    numVisitedDstNodes.assign(srcNodeIDs.size(), 0);
+    activeLanes = getLanesMask(srcNodeIDs.size());
+    result = std::make_unique<MultiSourceBFSResult>();
+    result->laneFrontiers.resize(srcNodeIDs.size());
+    for (auto lane = 0u; lane < srcNodeIDs.size(); ++lane) {
+        markSrc(srcNodeIDs[lane], lane);
+    }
+    addFrontierToResult(currentFrontier, currentLevel);
+    std::sort(currentFrontier.nodeIDs.begin(), currentFrontier.nodeIDs.end());
+}
+
+void MultiSourceBFSState::markSrc(nodeID_t nodeID, uint32_t lane) {
+    auto laneMask = getLaneMask(lane);
+    currentFrontier.nodeIDs.push_back(nodeID);
+    currentFrontier.laneMasks.insert({nodeID, laneMask});
+    if (trackMultiplicity) {
+        auto multiplicities = std::vector<uint64_t>(numVisitedDstNodes.size(), 0);
+        multiplicities[lane] = 1;
+        currentFrontier.laneMultiplicities.insert({nodeID, std::move(multiplicities)});
+    } else {
+        visited.insert({nodeID, laneMask});
+        markTargetVisited(nodeID, laneMask);
+    }
+}
+
+void MultiSourceBFSState::markTargetVisited(nodeID_t nodeID, lane_mask_t lanes) {
+    if (!targetDstNodes->contains(nodeID)) {
+        return;
+    }
+    forEachLane(lanes, [&](uint32_t lane) {
+        if (++numVisitedDstNodes[lane] == targetDstNodes->getNumNodes()) {
+            // All dst nodes are reached from this source. Stop its BFS.
+            activeLanes &= ~getLaneMask(lane);
+        }
+    });
+}
+
+nodeID_t MultiSourceBFSState::getNextNodeID() {
+    while (nextNodeIdxToExtend < currentFrontier.nodeIDs.size()) {
+        auto nodeID = currentFrontier.nodeIDs[nextNodeIdxToExtend++];
+        boundLanes = currentFrontier.laneMasks.at(nodeID) & activeLanes;
+        if (boundLanes == 0) {
+            continue;
+        }
+        if (trackMultiplicity) {
+            boundMultiplicities = &currentFrontier.laneMultiplicities.at(nodeID);
+        }
+        return nodeID;
+    }
+    return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+}
+
+void MultiSourceBFSState::markVisited(nodeID_t nbrNodeID) {
+    auto lanes = boundLanes & activeLanes;
+    if (lanes == 0) {
+        return;
+    }
+    if (!trackMultiplicity) {
+        auto& visitedLanes = visited[nbrNodeID];
+        lanes &= ~visitedLanes;
+        if (lanes == 0) {
+            return;
+        }
+        visitedLanes |= lanes;
+    }
+    auto [it, inserted] = nextFrontier.laneMasks.insert({nbrNodeID, 0});
+    if (inserted) {
+        nextFrontier.nodeIDs.push_back(nbrNodeID);
+    }
+    it->second |= lanes;
+    if (trackMultiplicity) {
+        auto& multiplicities = nextFrontier.laneMultiplicities[nbrNodeID];
+        if (multiplicities.empty()) {
+            multiplicities.resize(numVisitedDstNodes.size(), 0);
+        }
+        forEachLane(lanes,
+            [&](uint32_t lane) { multiplicities[lane] += (*boundMultiplicities)[lane]; });
+    } else {
+        markTargetVisited(nbrNodeID, lanes);
+    }
+}
+
+void MultiSourceBFSState::finalizeCurrentLevel() {
+    std::swap(currentFrontier, nextFrontier);
+    nextFrontier.resetState();
+    currentLevel++;
+    nextNodeIdxToExtend = 0;
+    addFrontierToResult(currentFrontier, currentLevel);
+    if (currentLevel < upperBound) { // No need to sort if we are not extending further.
+        std::sort(currentFrontier.nodeIDs.begin(), currentFrontier.nodeIDs.end());
+    }
+}
+
+std::unique_ptr<MultiSourceBFSResult> MultiSourceBFSState::getResult() {
+    // A shortest path BFS may complete in the middle of a level, once all dst nodes are reached.
+    // Dst nodes found so far in that level are still part of the result.
+    if (!nextFrontier.nodeIDs.empty()) {
+        addFrontierToResult(nextFrontier, currentLevel + 1);
+    }
+    return std::move(result);
+}
+
+void MultiSourceBFSState::addFrontierToResult(const MultiSourceFrontier& frontier,
+    uint8_t level) {
+    for (auto& laneFrontiers : result->laneFrontiers) {
+        KU_ASSERT(laneFrontiers.size() == level);
+        laneFrontiers.push_back(std::make_unique<Frontier>());
+    }
+    if (level < lowerBound) {
+        return;
+    }
+    for (auto& nodeID : frontier.nodeIDs) {
+        if (!targetDstNodes->contains(nodeID)) {
+            continue;
+        }
+        forEachLane(frontier.laneMasks.at(nodeID), [&](uint32_t lane) {
+            auto multiplicity =
+                trackMultiplicity ? frontier.laneMultiplicities.at(nodeID)[lane] : 1;
+            result->laneFrontiers[lane][level]->addNodeWithMultiplicity(nodeID, multiplicity);
+        });
+    }
+}
+
+std::shared_ptr<MultiSourceBFSResult> MultiSourceBFSSharedState::getResult(nodeID_t srcNodeID,
+    const compute_func_t& computeFunc, storage::MemoryManager* memoryManager, uint32_t& lane) {
+    std::unique_lock lck{mtx};
+    if (!initialized) {
+        initNoLock(memoryManager);
+        initialized = true;
+    }
+    if (!srcToBatchAndLane.contains(srcNodeID)) {
+        return nullptr;
+    }
+    auto [batchIdx, srcLane] = srcToBatchAndLane.at(srcNodeID);
+    lane = srcLane;
+    auto& batch = batches[batchIdx];
+    cv.wait(lck, [&] { return !batch.computing; });
+    if (batch.result == nullptr) {
+        batch.computing = true;
+        lck.unlock();
+        std::shared_ptr<MultiSourceBFSResult> result;
+        try {
+            result = computeFunc(batch.srcNodeIDs);
+        } catch (std::exception& e) {
+            lck.lock();
+            batch.computing = false;
+            lck.unlock();
+            cv.notify_all();
+            throw;
+        }
+        lck.lock();
+        batch.result = std::move(result);
+        batch.computing = false;
+        cv.notify_all();
+    }
+    auto result = batch.result;
+    KU_ASSERT(batch.numPendingTuples > 0);
+    if (--batch.numPendingTuples == 0) {
+        batch.result = nullptr;
+    }
+    return result;
+}
+
+void MultiSourceBFSSharedState::initNoLock(storage::MemoryManager* memoryManager) {
+    ValueVector vector{LogicalTypeID::INTERNAL_ID, memoryManager};
+    vector.setState(std::make_shared<DataChunkState>());
+    std::vector<ValueVector*> vectors{&vector};
+    std::vector<ft_col_idx_t> colIdxesToScan{srcColIdx};
+    auto isColFlat = srcTable->getTableSchema()->getColumn(srcColIdx)->isFlat();
+    auto numTuples = srcTable->getNumTuples();
+    uint64_t numTuplesToScan = 0;
+    for (auto tupleIdx = 0u; tupleIdx < numTuples; tupleIdx += numTuplesToScan) {
+        // An unflat column can only be read one tuple at a time.
+        numTuplesToScan = isColFlat ? std::min(DEFAULT_VECTOR_CAPACITY, numTuples - tupleIdx) : 1;
+        srcTable->scan(vectors, tupleIdx, numTuplesToScan, colIdxesToScan);
+        auto& selVector = vector.state->getSelVector();
+        for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+            auto pos = selVector[i];
+            if (vector.isNull(pos)) {
+                continue;
+            }
+            auto nodeID = vector.getValue<nodeID_t>(pos);
+            if (!srcTableIDs.contains(nodeID.tableID)) {
+                continue;
+            }
+            if (srcToBatchAndLane.contains(nodeID)) {
+                batches[srcToBatchAndLane.at(nodeID).first].numPendingTuples++;
+                continue;
+            }
+            if (batches.empty() ||
+                batches.back().srcNodeIDs.size() == MULTI_SOURCE_BFS_NUM_LANES) {
+                batches.emplace_back();
+            }
+            auto& batch = batches.back();
+            srcToBatchAndLane.insert({nodeID, {batches.size() - 1, batch.srcNodeIDs.size()}});
+            batch.srcNodeIDs.push_back(nodeID);
+            batch.numPendingTuples++;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
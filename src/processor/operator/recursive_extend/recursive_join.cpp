@@ -18,7 +18,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
     vectors->srcNodeIDVector = resultSet->getValueVector(dataInfo.srcNodePos).get();
     vectors->dstNodeIDVector = resultSet->getValueVector(dataInfo.dstNodePos).get();
     vectors->pathLengthVector = resultSet->getValueVector(dataInfo.pathLengthPos).get();
-    auto semantic = context->clientContext->getClientConfig()->recursivePatternSemantic;
+    auto semantic = context->clientConfig.recursivePatternSemantic;
     path_semantic_check_t semanticCheck = nullptr;
     std::vector<std::unique_ptr<BaseFrontierScanner>> scanners;
     auto joinType = info.joinType;
@@ -156,6 +156,11 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         vectors->pathRelsLabelDataVector =
             StructVector::getFieldVector(pathRelsDataVector, pathRelsLabelFieldIdx).get();
     }
+    if (sharedState->multiSourceBFSSharedState != nullptr) {
+        KU_ASSERT(joinType == planner::RecursiveJoinType::TRACK_NONE);
+        multiSourceBFSState = std::make_unique<MultiSourceBFSState>(info.queryRelType, lowerBound,
+            upperBound, targetDstNodes.get());
+    }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
     initLocalRecursivePlan(context);
 }
@@ -182,6 +187,13 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
         if (!children[0]->getNextTuple(context)) {
             return false;
         }
+        if (multiSourceBFSState != nullptr) {
+            auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+                vectors->srcNodeIDVector->state->getSelVector()[0]);
+            if (scanMultiSourceBFSResult(nodeID, context)) {
+                continue;
+            }
+        }
         bfsState->resetState();
         computeBFS(context); // Phase 1
         frontiersScanner->resetState(*bfsState);
@@ -236,6 +248,44 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+bool RecursiveJoin::scanMultiSourceBFSResult(nodeID_t srcNodeID, ExecutionContext* context) {
+    uint32_t lane = 0;
+    multiSourceBFSResult = sharedState->multiSourceBFSSharedState->getResult(srcNodeID,
+        [&](const std::vector<nodeID_t>& srcNodeIDs) {
+            return computeMultiSourceBFS(srcNodeIDs, context);
+        },
+        context->clientContext->getMemoryManager(), lane);
+    if (multiSourceBFSResult == nullptr) {
+        return false;
+    }
+    frontiersScanner->resetState(multiSourceBFSResult->getFrontiers(lane));
+    return true;
+}
+
+std::unique_ptr<MultiSourceBFSResult> RecursiveJoin::computeMultiSourceBFS(
+    const std::vector<nodeID_t>& srcNodeIDs, ExecutionContext* context) {
+    multiSourceBFSState->resetState(srcNodeIDs);
+    vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, true);
+    while (!multiSourceBFSState->isComplete()) {
+        auto boundNodeID = multiSourceBFSState->getNextNodeID();
+        if (boundNodeID.offset != INVALID_OFFSET) {
+            // Extend the node once for all sources that reached it.
+            recursiveSource->init(boundNodeID);
+            while (recursiveRoot->getNextTuple(context)) {
+                auto& selVector = vectors->recursiveDstNodeIDVector->state->getSelVector();
+                for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+                    multiSourceBFSState->markVisited(
+                        vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(selVector[i]));
+                }
+            }
+        } else {
+            multiSourceBFSState->finalizeCurrentLevel();
+            vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, false);
+        }
+    }
+    return multiSourceBFSState->getResult();
+}
+
 static PhysicalOperator* getSource(PhysicalOperator* op) {
     while (op->getNumChildren() != 0) {
         KU_ASSERT(op->getNumChildren() == 1);
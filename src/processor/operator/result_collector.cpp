@@ -1,5 +1,7 @@
 #include "processor/operator/result_collector.h"
 
+#include "common/exception/interrupt.h"
+
 using namespace kuzu::common;
 using namespace kuzu::storage;
 
@@ -25,18 +27,40 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    auto chunkQueue = sharedState->getChunkQueue();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (chunkQueue != nullptr &&
+                localTable->getNumTuples() >= ResultChunkQueue::CHUNK_NUM_TUPLES) {
+                pushLocalTableToQueue(context);
+            }
         }
     }
-    if (!payloadVectors.empty()) {
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (chunkQueue != nullptr) {
+        if (!localTable->isEmpty()) {
+            pushLocalTableToQueue(context);
+        }
+    } else {
         sharedState->mergeLocalTable(*localTable);
     }
 }
 
+void ResultCollector::pushLocalTableToQueue(ExecutionContext* context) {
+    auto chunk = std::move(localTable);
+    localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+        info->tableSchema.copy());
+    if (!sharedState->getChunkQueue()->push(std::move(chunk))) {
+        // The reader of the result stopped reading, so there is no need to run the query further.
+        throw InterruptException{};
+    }
+}
+
 void ResultCollector::finalize(ExecutionContext* /*context*/) {
     switch (info->accumulateType) {
     case AccumulateType::OPTIONAL_: {
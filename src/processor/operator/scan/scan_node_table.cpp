@@ -39,12 +39,35 @@ void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState) {
     scanState.source = TableScanSource::NONE;
 }
 
+bool ScanNodeTableInfo::canSkipNodeGroup() const {
+    // Statistics do not cover updates in local storage.
+    if (localScanState->source != TableScanSource::COMMITTED ||
+        localScanState->localNodeGroup != nullptr) {
+        return false;
+    }
+    for (auto i = 0u; i < columnPredicates.size(); ++i) {
+        if (columnPredicates[i].empty() || columnIDs[i] == INVALID_COLUMN_ID) {
+            continue;
+        }
+        auto& metadata = localScanState->dataScanState->chunkStates[i].metadata;
+        auto physicalType = table->getColumn(columnIDs[i])->getDataType().getPhysicalType();
+        for (auto& predicate : columnPredicates[i]) {
+            if (predicate.canSkipChunk(metadata.compMeta, physicalType)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
     for (auto& nodeInfo : nodeInfos) {
         nodeInfo.localScanState = std::make_unique<NodeTableScanState>(nodeInfo.columnIDs);
         initVectors(*nodeInfo.localScanState, *resultSet);
     }
+    numSkippedNodeGroups =
+        context->profiler->registerNumericMetric(getSkippedNodeGroupsMetricKey());
 }
 
 void ScanNodeTable::initGlobalStateInternal(ExecutionContext* context) {
@@ -69,6 +92,10 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
             currentTableIdx++;
         } else {
             info.table->initializeScanState(context->clientContext->getTx(), scanState);
+            if (info.canSkipNodeGroup()) {
+                scanState.source = TableScanSource::NONE;
+                numSkippedNodeGroups->increase(1);
+            }
         }
     }
     return false;
@@ -79,5 +106,13 @@ std::unique_ptr<PhysicalOperator> ScanNodeTable::clone() {
         paramsString);
 }
 
+std::unordered_map<std::string, std::string> ScanNodeTable::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = ScanTable::getProfilerKeyValAttributes(profiler);
+    result.insert({"SkippedNodeGroups",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getSkippedNodeGroupsMetricKey()))});
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
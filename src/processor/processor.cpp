@@ -3,6 +3,7 @@
 #include "processor/operator/result_collector.h"
 #include "processor/operator/sink.h"
 #include "processor/processor_task.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -25,12 +26,49 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
+    auto transaction = context->clientContext->getTx();
+    auto runPipelinesConcurrently = transaction != nullptr && transaction->isReadOnly() &&
+                                    canRunPipelinesConcurrently(lastOperator);
     context->clientContext->getProgressBar()->startProgress();
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    taskScheduler->scheduleTaskAndWaitOrError(task, context, runPipelinesConcurrently);
     context->clientContext->getProgressBar()->endProgress();
     return resultCollector->getResultFactorizedTable();
 }
 
+// Pipelines only communicate through the sinks that are their ancestors in the plan, except for
+// semi masks, expressions scans over an outer accumulate and the sinks writing to storage. We only
+// run sibling pipelines concurrently if none of these appears in the plan.
+bool QueryProcessor::canRunPipelinesConcurrently(PhysicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case PhysicalOperatorType::SEMI_MASKER:
+        return false;
+    case PhysicalOperatorType::IN_QUERY_CALL: {
+        if (op->getNumChildren() == 0) {
+            return false;
+        }
+    } break;
+    case PhysicalOperatorType::AGGREGATE:
+    case PhysicalOperatorType::HASH_JOIN_BUILD:
+    case PhysicalOperatorType::INTERSECT_BUILD:
+    case PhysicalOperatorType::ORDER_BY:
+    case PhysicalOperatorType::ORDER_BY_MERGE:
+    case PhysicalOperatorType::RESULT_COLLECTOR:
+    case PhysicalOperatorType::TOP_K:
+        break;
+    default: {
+        if (op->isSink()) {
+            return false;
+        }
+    }
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (!canRunPipelinesConcurrently(op->getChild(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     ExecutionContext* context) {
     if (op->isSource()) {
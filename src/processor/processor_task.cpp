@@ -1,15 +1,12 @@
 #include "processor/processor_task.h"
 
-#include "main/settings.h"
-
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
 ProcessorTask::ProcessorTask(Sink* sink, ExecutionContext* executionContext)
-    : Task{executionContext->clientContext->getCurrentSetting(main::ThreadsSetting::name)
-               .getValue<uint64_t>()},
+    : Task{executionContext->clientConfig.numThreads},
       sharedStateInitialized{false}, sink{sink}, executionContext{executionContext} {}
 
 void ProcessorTask::run() {
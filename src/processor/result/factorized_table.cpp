@@ -192,6 +192,17 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     return totalNumFlatTuples;
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    auto memoryUsage = inMemOverflowBuffer->getMemoryUsage();
+    for (auto& block : flatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->totalSize;
+    }
+    for (auto& block : unFlatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->totalSize;
+    }
+    return memoryUsage;
+}
+
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     std::unordered_map<uint32_t, bool> calculatedGroups;
     uint64_t numFlatTuples = 1;
@@ -601,6 +612,25 @@ void FlatTupleIterator::resetState() {
     }
 }
 
+ft_tuple_idx_t FlatTupleIterator::getNextTupleIdxOfFlatTable() const {
+    KU_ASSERT(!factorizedTable.hasUnflatCol());
+    // nextTupleIdx is the tuple after the current one, which may not have been read yet.
+    return nextFlatTupleIdx < numFlatTuples ? nextTupleIdx - 1 : nextTupleIdx;
+}
+
+void FlatTupleIterator::skipTuplesOfFlatTable(uint64_t numTuplesToSkip) {
+    auto tupleIdx = getNextTupleIdxOfFlatTable() + numTuplesToSkip;
+    if (tupleIdx < factorizedTable.getNumTuples()) {
+        currentTupleBuffer = factorizedTable.getTuple(tupleIdx);
+        numFlatTuples = 1;
+        nextFlatTupleIdx = 0;
+        nextTupleIdx = tupleIdx + 1;
+    } else {
+        nextFlatTupleIdx = numFlatTuples;
+        nextTupleIdx = factorizedTable.getNumTuples();
+    }
+}
+
 void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
     auto overflowValue =
         (overflow_value_t*)(valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
@@ -13,6 +13,12 @@ MarkHashTable::MarkHashTable(storage::MemoryManager& memoryManager,
     distinctColIdxInFT = hashColIdxInFT - 1;
 }
 
+std::unique_ptr<AggregateHashTable> MarkHashTable::createEmptyCopy(
+    uint64_t numEntriesToAllocate) const {
+    return std::make_unique<MarkHashTable>(memoryManager, keyTypes, payloadTypes,
+        numEntriesToAllocate, factorizedTable->getTableSchema()->copy());
+}
+
 uint64_t MarkHashTable::matchFTEntries(const std::vector<common::ValueVector*>& flatKeyVectors,
     const std::vector<common::ValueVector*>& unFlatKeyVectors, uint64_t numMayMatches,
     uint64_t numNoMatches) {
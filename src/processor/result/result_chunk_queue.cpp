@@ -0,0 +1,207 @@
+#include "processor/result/result_chunk_queue.h"
+
+#include "common/exception/exception.h"
+#include "common/serializer/buffered_serializer.h"
+#include "main/client_context.h"
+#include "processor/result/factorized_table_util.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+ResultChunkQueue::ResultChunkQueue(main::ClientContext* context,
+    std::vector<LogicalType> columnTypes, uint64_t capacity)
+    : context{context}, columnTypes{std::move(columnTypes)}, capacity{capacity},
+      numChunksInMemory{0}, numSpilledChunks{0}, finished{false}, closed{false}, numTuples{0},
+      startTime{std::chrono::steady_clock::now()} {
+    KU_ASSERT(capacity > 0);
+}
+
+bool ResultChunkQueue::push(std::unique_ptr<FactorizedTable> chunk) {
+    {
+        std::unique_lock lck{mtx};
+        if (closed) {
+            return false;
+        }
+        if (!timeToFirstChunk.has_value()) {
+            timeToFirstChunk = getElapsedTimeMSNoLock();
+        }
+        numTuples += chunk->getTotalNumFlatTuples();
+        if (numChunksInMemory < capacity) {
+            numChunksInMemory++;
+            chunks.push_back(std::move(chunk));
+            cv.notify_all();
+            return true;
+        }
+    }
+    // Threads pushing into the queue are workers of the task scheduler, which is shared by all
+    // connections, so they spill instead of waiting for the reader.
+    spillChunk(*chunk);
+    return true;
+}
+
+// A spilled chunk is written as its number of flat tuples followed by the values of each flat
+// tuple, and is read back as a table without unflat columns.
+void ResultChunkQueue::spillChunk(const FactorizedTable& chunk) {
+    auto buffer = std::make_shared<BufferedSerializer>();
+    Serializer serializer{buffer};
+    serializer.serializeValue<uint64_t>(chunk.getTotalNumFlatTuples());
+    std::vector<std::unique_ptr<Value>> values;
+    std::vector<Value*> valuesToCollect;
+    for (auto& columnType : columnTypes) {
+        values.push_back(std::make_unique<Value>(Value::createDefaultValue(columnType)));
+        valuesToCollect.push_back(values.back().get());
+    }
+    // The iterator does not modify the table.
+    FlatTupleIterator iterator{const_cast<FactorizedTable&>(chunk), valuesToCollect};
+    while (iterator.hasNextFlatTuple()) {
+        iterator.getNextFlatTuple();
+        for (auto& value : values) {
+            value->serialize(serializer);
+        }
+    }
+    std::unique_lock lck{mtx};
+    if (closed) {
+        return;
+    }
+    if (spilledSegments.empty() || spilledSegments.back()->deserializer != nullptr) {
+        auto segment = std::make_shared<SpilledSegment>();
+        segment->file = std::make_unique<SpillFile>(context);
+        spilledSegments.push_back(std::move(segment));
+    }
+    auto& segment = *spilledSegments.back();
+    segment.file->getSerializer().write(buffer->getBlobData(), buffer->getSize());
+    segment.numChunks++;
+    numSpilledChunks++;
+    chunks.push_back(nullptr);
+    cv.notify_all();
+}
+
+std::unique_ptr<FactorizedTable> ResultChunkQueue::readSpilledChunk(
+    Deserializer& deserializer) const {
+    auto memoryManager = context->getMemoryManager();
+    auto chunk = std::make_unique<FactorizedTable>(memoryManager,
+        FactorizedTableUtils::createFlatTableSchema(LogicalType::copy(columnTypes)));
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    std::vector<std::unique_ptr<ValueVector>> vectors;
+    std::vector<ValueVector*> vectorsToAppend;
+    for (auto& columnType : columnTypes) {
+        vectors.push_back(std::make_unique<ValueVector>(columnType, memoryManager));
+        vectors.back()->setState(state);
+        vectorsToAppend.push_back(vectors.back().get());
+    }
+    uint64_t numTuples = 0;
+    deserializer.deserializeValue(numTuples);
+    for (auto i = 0u; i < numTuples; i++) {
+        for (auto& vector : vectors) {
+            vector->resetAuxiliaryBuffer();
+            vector->copyFromValue(0, *Value::deserialize(deserializer));
+        }
+        chunk->append(vectorsToAppend);
+    }
+    return chunk;
+}
+
+bool ResultChunkQueue::hasNextChunk() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return finished || !chunks.empty(); });
+    if (errMsg.has_value()) {
+        throw Exception(*errMsg);
+    }
+    return !chunks.empty();
+}
+
+std::unique_ptr<FactorizedTable> ResultChunkQueue::popChunk() {
+    std::shared_ptr<SpilledSegment> segment;
+    {
+        std::unique_lock lck{mtx};
+        KU_ASSERT(!chunks.empty());
+        auto chunk = std::move(chunks.front());
+        chunks.pop_front();
+        if (chunk != nullptr) {
+            numChunksInMemory--;
+            return chunk;
+        }
+        KU_ASSERT(!spilledSegments.empty());
+        segment = spilledSegments.front();
+        if (segment->deserializer == nullptr) {
+            // Chunks spilled from now on go to a new segment.
+            segment->deserializer = segment->file->getDeserializer();
+        }
+    }
+    // Nothing is written to a segment once it is read from, so the chunk is read without holding
+    // the lock. The segment is kept alive in case the queue is cleared meanwhile.
+    auto chunk = readSpilledChunk(*segment->deserializer);
+    std::unique_lock lck{mtx};
+    if (--segment->numChunks == 0 && !spilledSegments.empty() &&
+        spilledSegments.front() == segment) {
+        spilledSegments.pop_front();
+    }
+    return chunk;
+}
+
+void ResultChunkQueue::finish(std::optional<std::string> errMsg_) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    errMsg = std::move(errMsg_);
+    if (errMsg.has_value()) {
+        clearNoLock();
+    }
+    executionTime = getElapsedTimeMSNoLock();
+    if (!timeToFirstChunk.has_value()) {
+        timeToFirstChunk = executionTime;
+    }
+    cv.notify_all();
+}
+
+void ResultChunkQueue::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    clearNoLock();
+    cv.notify_all();
+}
+
+bool ResultChunkQueue::isFinished() {
+    std::unique_lock lck{mtx};
+    return finished;
+}
+
+std::optional<std::string> ResultChunkQueue::getErrorMessage() {
+    std::unique_lock lck{mtx};
+    return errMsg;
+}
+
+uint64_t ResultChunkQueue::getNumTuples() {
+    std::unique_lock lck{mtx};
+    return numTuples;
+}
+
+uint64_t ResultChunkQueue::getNumSpilledChunks() {
+    std::unique_lock lck{mtx};
+    return numSpilledChunks;
+}
+
+std::optional<double> ResultChunkQueue::getTimeToFirstChunk() {
+    std::unique_lock lck{mtx};
+    return timeToFirstChunk;
+}
+
+std::optional<double> ResultChunkQueue::getExecutionTime() {
+    std::unique_lock lck{mtx};
+    return executionTime;
+}
+
+void ResultChunkQueue::clearNoLock() {
+    chunks.clear();
+    numChunksInMemory = 0;
+    spilledSegments.clear();
+}
+
+double ResultChunkQueue::getElapsedTimeMSNoLock() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime)
+        .count();
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,46 @@
+#include "processor/result/spill_file.h"
+
+#include <fcntl.h>
+
+#include "common/file_system/file_info.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_format.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+std::atomic<uint64_t> SpillFile::nextFileIdx{0};
+
+SpillFile::SpillFile(main::ClientContext* context) : context{context} {
+    // The address of the object tells apart files of database instances sharing a directory in
+    // different processes.
+    path = FileSystem::joinPath(context->getDatabasePath(),
+        stringFormat(".spill_{}_{}", reinterpret_cast<uintptr_t>(this), nextFileIdx.fetch_add(1)));
+    auto fileInfo = context->getVFSUnsafe()->openFile(path, O_CREAT | O_RDWR | O_TRUNC, context);
+    writer = std::make_shared<BufferedFileWriter>(std::move(fileInfo));
+    serializer = std::make_unique<Serializer>(writer);
+}
+
+SpillFile::~SpillFile() {
+    // Nothing left in the buffer needs to reach the file.
+    writer->resetOffsets();
+    serializer.reset();
+    writer.reset();
+    try {
+        context->getVFSUnsafe()->removeFileIfExists(path);
+    } catch (...) { // NOLINT(bugprone-empty-catch): Leaving a temporary file behind is harmless.
+    }
+}
+
+std::unique_ptr<Deserializer> SpillFile::getDeserializer() {
+    writer->flush();
+    auto fileInfo = context->getVFSUnsafe()->openFile(path, O_RDONLY, context);
+    auto reader = std::make_unique<BufferedFileReader>(std::move(fileInfo));
+    return std::make_unique<Deserializer>(std::move(reader));
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,67 @@
+#include "storage/buffer_manager/async_page_reader.h"
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace storage {
+
+AsyncPageReader::AsyncPageReader(uint64_t numThreads) : numThreads{numThreads}, numPendingReads{0}, stopped{false} {
+    KU_ASSERT(numThreads > 0);
+}
+
+AsyncPageReader::~AsyncPageReader() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+        cv.notify_all();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void AsyncPageReader::submit(std::function<void()> read) {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(!stopped);
+    if (threads.empty()) {
+        startThreadsNoLock();
+    }
+    reads.push_back(std::move(read));
+    numPendingReads++;
+    cv.notify_one();
+}
+
+void AsyncPageReader::waitForPendingReads() {
+    std::unique_lock lck{mtx};
+    cvForPendingReads.wait(lck, [&] { return numPendingReads == 0; });
+}
+
+void AsyncPageReader::startThreadsNoLock() {
+    threads.reserve(numThreads);
+    for (auto i = 0u; i < numThreads; i++) {
+        threads.emplace_back([this]() { runReadLoop(); });
+    }
+}
+
+void AsyncPageReader::runReadLoop() {
+    while (true) {
+        std::function<void()> read;
+        {
+            std::unique_lock lck{mtx};
+            cv.wait(lck, [&] { return stopped || !reads.empty(); });
+            if (reads.empty()) {
+                return;
+            }
+            read = std::move(reads.front());
+            reads.pop_front();
+        }
+        read();
+        std::unique_lock lck{mtx};
+        if (--numPendingReads == 0) {
+            cvForPendingReads.notify_all();
+        }
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
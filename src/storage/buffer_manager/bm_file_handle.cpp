@@ -1,5 +1,7 @@
 #include "storage/buffer_manager/bm_file_handle.h"
 
+#include <thread>
+
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/storage_utils.h"
 
@@ -21,13 +23,16 @@ BMFileHandle::BMFileHandle(const std::string& path, uint8_t flags, BufferManager
     common::VirtualFileSystem* vfs, main::ClientContext* context)
     : FileHandle{path, flags, vfs, context}, fileVersionedType{fileVersionedType}, bm{bm},
       pageSizeClass{pageSizeClass}, pageStates{numPages, pageCapacity},
-      frameGroupIdxes{getNumPageGroups(), getNumPageGroups()} {
+      frameGroupIdxes{getNumPageGroups(), getNumPageGroups()}, numPendingAsyncReads{0} {
     for (auto i = 0u; i < frameGroupIdxes.size(); i++) {
         frameGroupIdxes[i] = bm->addNewFrameGroup(pageSizeClass);
     }
 }
 
 BMFileHandle::~BMFileHandle() {
+    while (numPendingAsyncReads.load() > 0) {
+        std::this_thread::yield();
+    }
     bm->removeFilePagesFromFrames(*this);
 }
 
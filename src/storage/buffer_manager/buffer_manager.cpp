@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/constants.h"
@@ -17,6 +18,65 @@ using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
+EvictionQueue::EvictionQueue(EvictionPolicy policy) : policy{policy} {
+    queue = std::make_unique<LockedQueue<EvictionCandidate>>();
+    if (policy == EvictionPolicy::SCAN_RESISTANT) {
+        probationQueue = std::make_unique<LockedQueue<EvictionCandidate>>();
+    }
+}
+
+void EvictionQueue::enqueue(BMFileHandle* fileHandle, page_idx_t pageIdx, PageState* pageState,
+    uint64_t pageVersion) {
+    std::shared_lock sLck{mtx};
+    EvictionCandidate candidate{fileHandle, pageIdx, pageState, pageVersion};
+    // Pages are reset to version 0 when evicted, so a page with version 1 was read into its frame
+    // by the pin it was just unpinned from.
+    if (policy == EvictionPolicy::SCAN_RESISTANT && pageVersion <= 1) {
+        candidate.inProbation = true;
+        probationQueue->enqueue(candidate);
+    } else {
+        queue->enqueue(candidate);
+    }
+}
+
+void EvictionQueue::enqueueSecondChanceNoLock(EvictionCandidate& candidate) {
+    if (!candidate.inProbation) {
+        queue->enqueue(candidate);
+    } else if (candidate.accessedInProbation) {
+        candidate.inProbation = false;
+        queue->enqueue(candidate);
+    } else {
+        candidate.accessedInProbation = true;
+        probationQueue->enqueue(candidate);
+    }
+}
+
+bool EvictionQueue::dequeue(EvictionCandidate& candidate) {
+    std::shared_lock sLck{mtx};
+    if (policy == EvictionPolicy::FIFO) {
+        return queue->try_dequeue(candidate);
+    }
+    if (shouldDequeueFromProbationQueue() && probationQueue->try_dequeue(candidate)) {
+        return true;
+    }
+    return queue->try_dequeue(candidate) || probationQueue->try_dequeue(candidate);
+}
+
+bool EvictionQueue::shouldDequeueFromProbationQueue() {
+    auto numProbationCandidates = probationQueue->size();
+    auto numCandidates = numProbationCandidates + queue->size();
+    return (double)numProbationCandidates >=
+           (double)numCandidates * BufferPoolConstants::SCAN_RESISTANT_MIN_PROBATION_RATIO;
+}
+
+void EvictionQueue::removeNonEvictableCandidates() {
+    std::shared_lock sLck{mtx};
+    removeNonEvictableCandidates(*queue);
+    if (probationQueue) {
+        removeNonEvictableCandidates(*probationQueue);
+    }
+}
+
 // In this function, we try to remove as many as possible candidates that are not evictable from the
 // eviction queue until we hit a candidate that is evictable.
 // 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
@@ -25,21 +85,20 @@ namespace storage {
 // the page was optimistically read, we give a second chance to evict the page by marking the page
 // as MARKED, and moving the candidate to the back of the queue.
 // 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
-void EvictionQueue::removeNonEvictableCandidates() {
-    std::shared_lock sLck{mtx};
+void EvictionQueue::removeNonEvictableCandidates(LockedQueue<EvictionCandidate>& queueToPurge) {
     while (true) {
         EvictionCandidate evictionCandidate;
-        if (!queue->try_dequeue(evictionCandidate)) {
+        if (!queueToPurge.try_dequeue(evictionCandidate)) {
             break;
         }
         auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
         if (evictionCandidate.isEvictable(pageStateAndVersion)) {
-            queue->enqueue(evictionCandidate);
+            queueToPurge.enqueue(evictionCandidate);
             break;
         } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
             // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
             evictionCandidate.pageState->tryMark(pageStateAndVersion);
-            queue->enqueue(evictionCandidate);
+            enqueueSecondChanceNoLock(evictionCandidate);
             continue;
         } else {
             // Cases to remove the candidate from the queue:
@@ -54,24 +113,36 @@ void EvictionQueue::removeNonEvictableCandidates() {
 
 void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
     std::unique_lock xLck{mtx};
+    removeCandidatesForFile(*queue, fileHandle);
+    if (probationQueue) {
+        removeCandidatesForFile(*probationQueue, fileHandle);
+    }
+}
+
+void EvictionQueue::removeCandidatesForFile(LockedQueue<EvictionCandidate>& queueToPurge,
+    BMFileHandle& fileHandle) {
     EvictionCandidate candidate;
     uint64_t loopedCandidateIdx = 0;
-    auto numCandidatesInQueue = queue->size();
-    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
+    auto numCandidatesInQueue = queueToPurge.size();
+    while (loopedCandidateIdx < numCandidatesInQueue && queueToPurge.try_dequeue(candidate)) {
         if (candidate.fileHandle != &fileHandle) {
-            queue->enqueue(candidate);
+            queueToPurge.enqueue(candidate);
         }
         loopedCandidateIdx++;
     }
 }
 
-BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
-    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0} {
+BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize,
+    EvictionPolicy evictionPolicy, uint64_t readAheadNumPages, bool asyncReadAhead)
+    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0},
+      readAheadNumPages{readAheadNumPages}, asyncReadAhead{asyncReadAhead} {
     verifySizeParams(bufferPoolSize, maxDBSize);
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(PageSizeClass::PAGE_4KB, maxDBSize);
     vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, bufferPoolSize);
-    evictionQueue = std::make_unique<EvictionQueue>();
+    evictionQueue = std::make_unique<EvictionQueue>(evictionPolicy);
+    asyncPageReader =
+        std::make_unique<AsyncPageReader>(BufferPoolConstants::NUM_ASYNC_READ_AHEAD_THREADS);
 }
 
 void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize) {
@@ -100,6 +171,7 @@ void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize
 // both get access to the same piece of memory.
 uint8_t* BufferManager::pin(BMFileHandle& fileHandle, page_idx_t pageIdx,
     PageReadPolicy pageReadPolicy) {
+    countPageAccess(fileHandle);
     auto pageState = fileHandle.getPageState(pageIdx);
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
@@ -192,6 +264,8 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
 #endif
+    // If the page is evicted, the access is counted by `pin()`.
+    auto pinned = false;
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
@@ -201,6 +275,9 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
                 continue;
             }
             if (pageState->getStateAndVersion() == currStateAndVersion) {
+                if (!pinned) {
+                    countPageAccess(fileHandle);
+                }
                 return;
             }
         } break;
@@ -209,6 +286,9 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
             if (pageState->tryClearMark(currStateAndVersion)) {
                 if (try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                         fileHandle.getPageSizeClass())) {
+                    if (!pinned) {
+                        countPageAccess(fileHandle);
+                    }
                     return;
                 }
             }
@@ -216,6 +296,7 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
         case PageState::EVICTED: {
             pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
             unpin(fileHandle, pageIdx);
+            pinned = true;
         } break;
         default: {
             // When locked, continue the spinning.
@@ -233,31 +314,39 @@ void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
 
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
-// memory is available.
-// First, we reserve the memory for the page, which increments the atomic counter `usedMemory`.
+// memory is available (see `reserveMemory()`). Once the memory is reserved, we load the page to its
+// corresponding frame and return true.
+bool BufferManager::claimAFrame(BMFileHandle& fileHandle, page_idx_t pageIdx,
+    PageReadPolicy pageReadPolicy) {
+    if (!reserveMemory(fileHandle.getPageSize())) {
+        return false;
+    }
+    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
+    return true;
+}
+
+// First, we reserve the memory, which increments the atomic counter `usedMemory`.
 // Then, we check if there is enough memory available. If not, we evict pages until we have enough
 // or we can find no more pages to be evicted.
 // Lastly, we double check if the needed memory is available. If not, we free the memory we reserved
-// and return false, otherwise, we load the page to its corresponding frame and return true.
-bool BufferManager::claimAFrame(BMFileHandle& fileHandle, page_idx_t pageIdx,
-    PageReadPolicy pageReadPolicy) {
-    page_offset_t pageSizeToClaim = fileHandle.getPageSize();
-    // Reserve the memory for the page.
-    auto currentUsedMem = reserveUsedMemory(pageSizeToClaim);
+// and return false, otherwise, we free the memory of the evicted pages and return true.
+bool BufferManager::reserveMemory(uint64_t sizeToClaim) {
+    // Reserve the memory.
+    auto currentUsedMem = reserveUsedMemory(sizeToClaim);
     uint64_t claimedMemory = 0;
     // Evict pages if necessary until we have enough memory.
-    while ((currentUsedMem + pageSizeToClaim - claimedMemory) > bufferPoolSize.load()) {
+    while ((currentUsedMem + sizeToClaim - claimedMemory) > bufferPoolSize.load()) {
         EvictionCandidate evictionCandidate;
         if (!evictionQueue->dequeue(evictionCandidate)) {
             // Cannot find more pages to be evicted. Free the memory we reserved and return false.
-            freeUsedMemory(pageSizeToClaim);
+            freeUsedMemory(sizeToClaim);
             return false;
         }
         auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
         if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
             if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
                 evictionCandidate.pageState->tryMark(pageStateAndVersion);
-                evictionQueue->enqueue(evictionCandidate);
+                evictionQueue->enqueueSecondChance(evictionCandidate);
             }
             continue;
         }
@@ -267,17 +356,92 @@ bool BufferManager::claimAFrame(BMFileHandle& fileHandle, page_idx_t pageIdx,
         claimedMemory += tryEvictPage(evictionCandidate);
         currentUsedMem = usedMemory.load();
     }
-    if ((currentUsedMem + pageSizeToClaim - claimedMemory) > bufferPoolSize.load()) {
+    if ((currentUsedMem + sizeToClaim - claimedMemory) > bufferPoolSize.load()) {
         // Cannot claim the memory needed. Free the memory we reserved and return false.
-        freeUsedMemory(pageSizeToClaim);
+        freeUsedMemory(sizeToClaim);
         return false;
     }
-    // Have enough memory available now, load the page into its corresponding frame.
-    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
     freeUsedMemory(claimedMemory);
     return true;
 }
 
+// Prefetching locks the EVICTED pages of the range one by one, as `pin()` does, and claims a frame
+// for each of them. As the frames of a page group are consecutive in the VMRegion, the locked pages
+// are then read from the file into their frames with a single read, and unpinned so that they can
+// be optimistically read or evicted like any other page.
+void BufferManager::prefetchPageRange(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    auto endPageIdx = lockPagesToPrefetch(fileHandle, startPageIdx, numPages);
+    if (endPageIdx == startPageIdx) {
+        return;
+    }
+    readPrefetchedPages(fileHandle, startPageIdx, endPageIdx);
+}
+
+// If the background read fails, the pages are reset to EVICTED, so that the next access reads them
+// again and reports the error to its caller.
+void BufferManager::prefetchPageRangeAsync(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    auto endPageIdx = lockPagesToPrefetch(fileHandle, startPageIdx, numPages);
+    if (endPageIdx == startPageIdx) {
+        return;
+    }
+    fileHandle.numPendingAsyncReads++;
+    asyncPageReader->submit([this, &fileHandle, startPageIdx, endPageIdx]() {
+        try {
+            readPrefetchedPages(fileHandle, startPageIdx, endPageIdx);
+            numAsyncPageReads.add(endPageIdx - startPageIdx);
+        } catch (std::exception&) {
+            for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+                releaseFrameForPage(fileHandle, pageIdx);
+                freeUsedMemory(fileHandle.getPageSize());
+                fileHandle.getPageState(pageIdx)->resetToEvicted();
+            }
+        }
+        fileHandle.numPendingAsyncReads--;
+    });
+}
+
+page_idx_t BufferManager::lockPagesToPrefetch(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    if (fileHandle.isNewTmpFile() || startPageIdx >= fileHandle.getNumPages()) {
+        return startPageIdx;
+    }
+    auto endPageIdx = std::min(startPageIdx + numPages, fileHandle.getNumPages());
+    auto pageIdx = startPageIdx;
+    while (pageIdx < endPageIdx) {
+        if (pageIdx != startPageIdx &&
+            (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) == 0) {
+            // Frames are only consecutive within a page group.
+            break;
+        }
+        auto pageState = fileHandle.getPageState(pageIdx);
+        auto currStateAndVersion = pageState->getStateAndVersion();
+        if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+            !pageState->tryLock(currStateAndVersion)) {
+            break;
+        }
+        if (!reserveMemory(fileHandle.getPageSize())) {
+            pageState->resetToEvicted();
+            break;
+        }
+        pageState->clearDirty();
+        pageIdx++;
+    }
+    return pageIdx;
+}
+
+void BufferManager::readPrefetchedPages(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t endPageIdx) {
+    fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, startPageIdx),
+        (endPageIdx - startPageIdx) * fileHandle.getPageSize(),
+        startPageIdx * fileHandle.getPageSize());
+    countPageReads(fileHandle, endPageIdx - startPageIdx);
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        unpin(fileHandle, pageIdx);
+    }
+}
+
 void BufferManager::addToEvictionQueue(BMFileHandle* fileHandle, page_idx_t pageIdx,
     PageState* pageState) {
     auto currStateAndVersion = pageState->getStateAndVersion();
@@ -304,6 +468,7 @@ uint64_t BufferManager::tryEvictPage(EvictionCandidate& candidate) {
     auto numBytesFreed = candidate.fileHandle->getPageSize();
     releaseFrameForPage(*candidate.fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
+    numEvictions.add(1);
     return numBytesFreed;
 }
 
@@ -314,6 +479,7 @@ void BufferManager::cachePageIntoFrame(BMFileHandle& fileHandle, page_idx_t page
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
         fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, pageIdx),
             fileHandle.getPageSize(), pageIdx * fileHandle.getPageSize());
+        countPageReads(fileHandle, 1);
     }
 }
 
@@ -1,5 +1,6 @@
 #include "storage/compression/compression.h"
 
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -58,7 +59,8 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::ALP: {
         return false;
     }
     default: {
@@ -118,6 +120,24 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos,
                 return false;
             });
     }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            auto value = reinterpret_cast<const double*>(data)[pos];
+            return FloatCompression<double>::canUpdateInPlace(value, *this);
+        }
+        case PhysicalTypeID::FLOAT: {
+            auto value = reinterpret_cast<const float*>(data)[pos];
+            return FloatCompression<float>::canUpdateInPlace(value, *this);
+        }
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -166,6 +186,20 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::ALP: {
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, *this);
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, *this);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -259,6 +293,12 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::ALP: {
+        uint8_t bitWidth = physicalType == PhysicalTypeID::DOUBLE ?
+                               FloatCompression<double>::getBitWidth(*this) :
+                               FloatCompression<float>::getBitWidth(*this);
+        return stringFormat("ALP[{}, {}]", exponent, bitWidth);
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -609,6 +649,138 @@ void BooleanBitpacking::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOffse
         reinterpret_cast<uint64_t*>(dstBuffer), dstOffset, numValues);
 }
 
+static constexpr double POWERS_OF_10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+template<FloatCompressionType T>
+typename FloatCompression<T>::EncodedType FloatCompression<T>::encode(T value, uint8_t exponent) {
+    return static_cast<EncodedType>(
+        std::llround(static_cast<double>(value) * POWERS_OF_10[exponent]));
+}
+
+template<FloatCompressionType T>
+T FloatCompression<T>::decode(EncodedType value, uint8_t exponent) {
+    // Division (rather than multiplying by 10^-e) is exact for the powers of 10 we use, so any
+    // decimal with at most e fractional digits round-trips.
+    return static_cast<T>(static_cast<double>(value) / POWERS_OF_10[exponent]);
+}
+
+template<FloatCompressionType T>
+bool FloatCompression<T>::tryEncode(T value, uint8_t exponent, EncodedType& result) {
+    auto scaled = static_cast<double>(value) * POWERS_OF_10[exponent];
+    // Also rejects NaN and infinity
+    if (!(std::abs(scaled) < MAX_ENCODED_VALUE)) {
+        return false;
+    }
+    result = encode(value, exponent);
+    auto decoded = decode(result, exponent);
+    // Compare bits so that e.g. -0.0 is not replaced by 0.0
+    return std::memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+template<FloatCompressionType T>
+std::optional<CompressionMetadata> FloatCompression<T>::analyze(const T* values,
+    uint64_t numValues, StorageValue min, StorageValue max) {
+    // Use the smallest exponent which works for all values. Exponents which are too small usually
+    // fail on one of the first few values.
+    for (uint8_t exponent = 0; exponent <= MAX_EXPONENT; exponent++) {
+        EncodedType encoded;
+        auto i = 0u;
+        for (; i < numValues; i++) {
+            if (!tryEncode(values[i], exponent, encoded)) {
+                break;
+            }
+        }
+        if (i < numValues) {
+            continue;
+        }
+        auto metadata = CompressionMetadata(min, max, CompressionType::ALP, exponent);
+        if (getBitWidth(metadata) >= sizeof(T) * 8) {
+            return std::nullopt;
+        }
+        return metadata;
+    }
+    return std::nullopt;
+}
+
+template<FloatCompressionType T>
+CompressionMetadata FloatCompression<T>::getEncodedMetadata(const CompressionMetadata& metadata) {
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    // Encoding is monotonic, so the encoded bounds are the bounds of the encoded values
+    return CompressionMetadata(StorageValue(encode(metadata.min.get<T>(), metadata.exponent)),
+        StorageValue(encode(metadata.max.get<T>(), metadata.exponent)),
+        CompressionType::INTEGER_BITPACKING);
+}
+
+template<FloatCompressionType T>
+bool FloatCompression<T>::canUpdateInPlace(T value, const CompressionMetadata& metadata) {
+    EncodedType encoded;
+    return tryEncode(value, metadata.exponent, encoded) &&
+           IntegerBitpacking<EncodedType>::canUpdateInPlace(encoded, getEncodedMetadata(metadata));
+}
+
+template<FloatCompressionType T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
+    uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues, const CompressionMetadata& metadata,
+    const NullMask* nullMask) const {
+    auto encodedMetadata = getEncodedMetadata(metadata);
+    auto encoded = std::make_unique<EncodedType[]>(numValues);
+    for (auto i = 0u; i < numValues; i++) {
+        // Null values may not be encodable, and their stored value doesn't matter
+        if (nullMask && nullMask->isNull(srcOffset + i)) {
+            encoded[i] = encodedMetadata.min.get<EncodedType>();
+            continue;
+        }
+        auto value = reinterpret_cast<const T*>(srcBuffer)[srcOffset + i];
+        KU_ASSERT(canUpdateInPlace(value, metadata));
+        encoded[i] = encode(value, metadata.exponent);
+    }
+    IntegerBitpacking<EncodedType>().setValuesFromUncompressed(
+        reinterpret_cast<const uint8_t*>(encoded.get()), 0 /*srcOffset*/, dstBuffer, dstOffset,
+        numValues, encodedMetadata, nullptr /*nullMask*/);
+}
+
+template<FloatCompressionType T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    auto encodedMetadata = getEncodedMetadata(metadata);
+    auto numValuesToCompress = std::min(numValuesRemaining,
+        IntegerBitpacking<EncodedType>::numValues(dstBufferSize, encodedMetadata));
+    auto encoded = std::make_unique<EncodedType[]>(numValuesToCompress);
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        encoded[i] = encode(reinterpret_cast<const T*>(srcBuffer)[i], metadata.exponent);
+    }
+    auto encodedBuffer = reinterpret_cast<const uint8_t*>(encoded.get());
+    auto compressedSize = IntegerBitpacking<EncodedType>().compressNextPage(encodedBuffer,
+        numValuesToCompress, dstBuffer, dstBufferSize, encodedMetadata);
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return compressedSize;
+}
+
+template<FloatCompressionType T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    IntegerBitpacking<EncodedType>().decompressFromPage(srcBuffer, srcOffset, dstBuffer, dstOffset,
+        numValues, getEncodedMetadata(metadata));
+    auto values = dstBuffer + dstOffset * sizeof(T);
+    for (auto i = 0u; i < numValues; i++, values += sizeof(T)) {
+        EncodedType encoded;
+        memcpy(&encoded, values, sizeof(T));
+        auto value = decode(encoded, metadata.exponent);
+        memcpy(values, &value, sizeof(T));
+    }
+}
+
+template class FloatCompression<double>;
+template class FloatCompression<float>;
+
 void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, PageCursor& pageCursor,
     common::ValueVector* resultVector, uint32_t posInVector, uint32_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -666,6 +838,22 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -729,6 +917,22 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -768,6 +972,22 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().setValuesFromUncompressed(data, dataOffset, frame,
+                posInFrame, numValues, metadata, nullMask);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().setValuesFromUncompressed(data, dataOffset, frame,
+                posInFrame, numValues, metadata, nullMask);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
 
     default:
         KU_UNREACHABLE;
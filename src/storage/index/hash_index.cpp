@@ -1,5 +1,6 @@
 #include "storage/index/hash_index.h"
 
+#include <algorithm>
 #include <bitset>
 #include <cstdint>
 #include <type_traits>
@@ -127,6 +128,7 @@ HashIndex<T>::HashIndex(const DBFileIDAndName& dbFileIDAndName,
         Transaction::getDummyReadOnlyTrx().get(), true /*bypassWAL*/);
     // Initialize functions.
     localStorage = std::make_unique<HashIndexLocalStorage<T>>(overflowFileHandle);
+    hasMergedLocalStorage = false;
 }
 
 // For read transactions, local storage is skipped, lookups are performed on the persistent
@@ -197,6 +199,74 @@ size_t HashIndex<T>::append(const IndexBuffer<BufferKeyType>& buffer) {
     return localStorage->append(buffer);
 }
 
+template<typename T>
+void HashIndex<T>::lookupBatch(Transaction* transaction, std::span<Probe> probes,
+    offset_t* results) {
+    auto trxType = transaction->getType();
+    // Keys found or deleted in the local storage are resolved first. The remaining probes are moved
+    // to the front.
+    auto numPersistentProbes = probes.size();
+    if (!transaction->isReadOnly()) {
+        numPersistentProbes = 0;
+        for (auto& probe : probes) {
+            auto localLookupState = localStorage->lookup(probe.key, results[probe.resultPos]);
+            if (localLookupState == HashIndexLocalLookupState::KEY_DELETED) {
+                results[probe.resultPos] = INVALID_OFFSET;
+            } else if (localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST) {
+                probes[numPersistentProbes++] = probe;
+            }
+        }
+    }
+    auto persistentProbes = probes.first(numPersistentProbes);
+    for (auto& probe : persistentProbes) {
+        results[probe.resultPos] = INVALID_OFFSET;
+    }
+    auto& header = trxType == TransactionType::READ_ONLY ? *this->indexHeaderForReadTrx :
+                                                           *this->indexHeaderForWriteTrx;
+    if (header.numEntries == 0) {
+        return;
+    }
+    auto getPrimarySlotId = [&](const Probe& probe) {
+        return HashIndexUtils::getPrimarySlotIdForHash(header, probe.hash);
+    };
+    std::sort(persistentProbes.begin(), persistentProbes.end(),
+        [&](const Probe& a, const Probe& b) { return getPrimarySlotId(a) < getPrimarySlotId(b); });
+    std::vector<uint64_t> slotIds;
+    for (auto& probe : persistentProbes) {
+        auto slotId = getPrimarySlotId(probe);
+        if (slotIds.empty() || slotIds.back() != slotId) {
+            slotIds.push_back(slotId);
+        }
+    }
+    std::vector<Slot<T>> slots(slotIds.size());
+    pSlots->get(slotIds, trxType, std::span(slots));
+    auto slotPos = 0u;
+    for (auto& probe : persistentProbes) {
+        auto slotId = getPrimarySlotId(probe);
+        while (slotIds[slotPos] != slotId) {
+            slotPos++;
+        }
+        auto fingerprint = HashIndexUtils::getFingerprintForHash(probe.hash);
+        const auto& slot = slots[slotPos];
+        auto entryPos = findMatchedEntryInSlot(trxType, slot, probe.key, fingerprint);
+        if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+            results[probe.resultPos] = slot.entries[entryPos].value;
+            continue;
+        }
+        if (slot.header.nextOvfSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID) {
+            continue;
+        }
+        SlotIterator iter{SlotInfo{slotId, SlotType::PRIMARY}, slot};
+        while (nextChainedSlot(trxType, iter)) {
+            entryPos = findMatchedEntryInSlot(trxType, iter.slot, probe.key, fingerprint);
+            if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                results[probe.resultPos] = iter.slot.entries[entryPos].value;
+                break;
+            }
+        }
+    }
+}
+
 template<typename T>
 bool HashIndex<T>::lookupInPersistentIndex(TransactionType trxType, Key key, offset_t& result) {
     auto& header = trxType == TransactionType::READ_ONLY ? *this->indexHeaderForReadTrx :
@@ -278,16 +348,38 @@ entry_pos_t HashIndex<T>::findMatchedEntryInSlot(TransactionType trxType, const
     return SlotHeader::INVALID_ENTRY_POS;
 }
 
+template<typename T>
+bool HashIndex<T>::hasUpdates() const {
+    return localStorage->hasUpdates() || hasMergedLocalStorage;
+}
+
+template<typename T>
+void HashIndex<T>::applyLocalChanges() {
+    auto netInserts = localStorage->getNetInserts();
+    if (netInserts > 0) {
+        reserve(netInserts);
+    }
+    localStorage->applyLocalChanges([&](Key key) { deleteFromPersistentIndex(key); },
+        [&](const auto& insertions) { mergeBulkInserts(insertions); });
+}
+
+template<typename T>
+void HashIndex<T>::mergeLocalStorage() {
+    if (!localStorage->hasUpdates()) {
+        return;
+    }
+    applyLocalChanges();
+    localStorage->clear();
+    hasMergedLocalStorage = true;
+}
+
 template<typename T>
 void HashIndex<T>::prepareCommit() {
-    if (localStorage->hasUpdates()) {
+    if (hasUpdates()) {
         wal->addToUpdatedTables(dbFileIDAndName.dbFileID.nodeIndexID.tableID);
-        auto netInserts = localStorage->getNetInserts();
-        if (netInserts > 0) {
-            reserve(netInserts);
+        if (localStorage->hasUpdates()) {
+            applyLocalChanges();
         }
-        localStorage->applyLocalChanges([&](Key key) { deleteFromPersistentIndex(key); },
-            [&](const auto& insertions) { mergeBulkInserts(insertions); });
         DBFileUtils::updatePage(*fileHandle, dbFileIDAndName.dbFileID, headerPageIdx,
             true /*don't need to read original data*/, bm, *wal, [&](auto* frame) {
                 memcpy(frame, indexHeaderForWriteTrx.get(), sizeof(HashIndexHeader));
@@ -299,20 +391,21 @@ void HashIndex<T>::prepareCommit() {
 
 template<typename T>
 void HashIndex<T>::prepareRollback() {
-    if (localStorage->hasUpdates()) {
+    if (hasUpdates()) {
         wal->addToUpdatedTables(dbFileIDAndName.dbFileID.nodeIndexID.tableID);
     }
 }
 
 template<typename T>
 void HashIndex<T>::checkpointInMemory() {
-    if (!localStorage->hasUpdates()) {
+    if (!hasUpdates()) {
         return;
     }
     *indexHeaderForReadTrx = *indexHeaderForWriteTrx;
     pSlots->checkpointInMemoryIfNecessary();
     oSlots->checkpointInMemoryIfNecessary();
     localStorage->clear();
+    hasMergedLocalStorage = false;
     if constexpr (std::same_as<ku_string_t, T>) {
         overflowFileHandle->checkpointInMemory();
     }
@@ -320,12 +413,13 @@ void HashIndex<T>::checkpointInMemory() {
 
 template<typename T>
 void HashIndex<T>::rollbackInMemory() {
-    if (!localStorage->hasUpdates()) {
+    if (!hasUpdates()) {
         return;
     }
     pSlots->rollbackInMemoryIfNecessary();
     oSlots->rollbackInMemoryIfNecessary();
     localStorage->clear();
+    hasMergedLocalStorage = false;
     *indexHeaderForWriteTrx = *indexHeaderForReadTrx;
 }
 
@@ -366,6 +460,9 @@ void HashIndex<T>::splitSlots(HashIndexHeader& header, slot_id_t numSlotsToSplit
                     continue; // Skip invalid entries.
                 }
                 if (newEntryPos >= getSlotCapacity<T>()) {
+                    // Chain the full slot to the overflow slot which will be appended for it.
+                    newSlot->header.nextOvfSlotId =
+                        oSlots->getNumElements(TransactionType::WRITE) + newOverflowSlots.size();
                     newOverflowSlots.emplace_back();
                     newSlot = &newOverflowSlots.back();
                     newEntryPos = 0;
@@ -673,6 +770,51 @@ bool PrimaryKeyIndex::lookup(Transaction* trx, common::ValueVector* keyVector, u
     return retVal;
 }
 
+void PrimaryKeyIndex::lookupBatch(Transaction* trx, ValueVector* keyVector, offset_t* results) {
+    TypeUtils::visit(
+        keyDataTypeID, [&]<IndexHashable T>(T) { lookupBatch<T>(trx, keyVector, results); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+template<IndexHashable T>
+void PrimaryKeyIndex::lookupBatch(Transaction* trx, ValueVector* keyVector, offset_t* results) {
+    using Probe = typename HashIndex<T>::Probe;
+    auto& selVector = keyVector->state->getSelVector();
+    std::vector<Probe> probes;
+    probes.reserve(selVector.getSelSize());
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        auto pos = selVector[i];
+        if (keyVector->isNull(pos)) {
+            results[i] = INVALID_OFFSET;
+            continue;
+        }
+        typename HashIndex<T>::Key key;
+        if constexpr (std::same_as<T, ku_string_t>) {
+            key = keyVector->getValue<ku_string_t>(pos).getAsStringView();
+        } else {
+            key = keyVector->getValue<T>(pos);
+        }
+        probes.push_back(Probe{key, HashIndexUtils::hash(key), i});
+    }
+    // The hash index position is taken from the highest bits of the hash, so sorting by hash
+    // groups the probes of each hash index together.
+    std::sort(probes.begin(), probes.end(),
+        [](const Probe& a, const Probe& b) { return a.hash < b.hash; });
+    auto probeSpan = std::span(probes);
+    uint64_t startPos = 0;
+    while (startPos < probes.size()) {
+        auto indexPos = HashIndexUtils::getHashIndexPositionForHash(probes[startPos].hash);
+        auto endPos = startPos + 1;
+        while (endPos < probes.size() &&
+               HashIndexUtils::getHashIndexPositionForHash(probes[endPos].hash) == indexPos) {
+            endPos++;
+        }
+        getTypedHashIndexByPos<T>(indexPos)->lookupBatch(trx,
+            probeSpan.subspan(startPos, endPos - startPos), results);
+        startPos = endPos;
+    }
+}
+
 bool PrimaryKeyIndex::insert(common::ValueVector* keyVector, uint64_t vectorPos,
     common::offset_t value) {
     bool result = false;
@@ -0,0 +1,82 @@
+#include "storage/predicate/column_predicate.h"
+
+#include <cmath>
+
+#include "common/vector/value_vector.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+static bool hasStatistics(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        // Statistics of strings and lists are computed on offsets instead of values, and booleans
+        // are bit-packed, which in-place updates do not keep statistics of.
+        return false;
+    }
+}
+
+std::optional<ColumnPredicate> ColumnPredicate::tryCreate(ExpressionType expressionType,
+    const Value& value) {
+    if (!isExpressionComparison(expressionType) || value.isNull()) {
+        return std::nullopt;
+    }
+    auto physicalType = value.getDataType()->getPhysicalType();
+    if (!hasStatistics(physicalType)) {
+        return std::nullopt;
+    }
+    // Go through a vector so that the value is read the same way as column statistics are updated,
+    // whatever its logical type is (e.g. DATE is stored as INT32).
+    ValueVector vector{*value.getDataType()};
+    vector.state = DataChunkState::getSingleValueDataChunkState();
+    vector.copyFromValue(0, value);
+    auto storageValue = StorageValue::readFromVector(vector, 0);
+    if (!storageValue.has_value()) {
+        return std::nullopt;
+    }
+    return ColumnPredicate(expressionType, *storageValue);
+}
+
+bool ColumnPredicate::canSkip(const StorageValue& min, const StorageValue& max,
+    PhysicalTypeID physicalType) const {
+    auto isFloat = physicalType == PhysicalTypeID::DOUBLE || physicalType == PhysicalTypeID::FLOAT;
+    if (isFloat) {
+        // NaNs do not order with other values, so min/max computed over them are not bounds.
+        if (std::isnan(min.floatVal) || std::isnan(max.floatVal) || std::isnan(value.floatVal)) {
+            return false;
+        }
+    }
+    switch (expressionType) {
+    case ExpressionType::EQUALS:
+        return min.gt(value, physicalType) || value.gt(max, physicalType);
+    case ExpressionType::NOT_EQUALS:
+        // NaNs are not counted in min/max but satisfy not equals.
+        return !isFloat && min == max && min == value;
+    case ExpressionType::GREATER_THAN:
+        return !max.gt(value, physicalType);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return value.gt(max, physicalType);
+    case ExpressionType::LESS_THAN:
+        return !value.gt(min, physicalType);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return min.gt(value, physicalType);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -1,5 +1,7 @@
 #include "storage/storage_structure/disk_array.h"
 
+#include <algorithm>
+
 #include "common/cast.h"
 #include "common/constants.h"
 #include "common/string_format.h"
@@ -107,18 +109,48 @@ void DiskArrayInternal::get(uint64_t idx, TransactionType trxType, std::span<std
     KU_ASSERT(checkOutOfBoundAccess(trxType, idx));
     auto apCursor = getAPIdxAndOffsetInAP(header, idx);
     page_idx_t apPageIdx = getAPPageIdxNoLock(apCursor.pageIdx, trxType);
+    readAPNoLock(apPageIdx, trxType, [&val, &apCursor](const uint8_t* frame) -> void {
+        memcpy(val.data(), frame + apCursor.elemPosInPage, val.size());
+    });
+}
+
+void DiskArrayInternal::get(std::span<const uint64_t> idxes, TransactionType trxType,
+    std::span<std::byte> vals) {
+    if (idxes.empty()) {
+        return;
+    }
+    KU_ASSERT(std::is_sorted(idxes.begin(), idxes.end()));
+    KU_ASSERT(vals.size() % idxes.size() == 0);
+    auto valSize = vals.size() / idxes.size();
+    std::shared_lock sLck{diskArraySharedMtx};
+    uint64_t startPos = 0;
+    while (startPos < idxes.size()) {
+        KU_ASSERT(checkOutOfBoundAccess(trxType, idxes[startPos]));
+        auto apIdx = getAPIdxAndOffsetInAP(header, idxes[startPos]).pageIdx;
+        auto endPos = startPos + 1;
+        while (endPos < idxes.size() &&
+               getAPIdxAndOffsetInAP(header, idxes[endPos]).pageIdx == apIdx) {
+            endPos++;
+        }
+        readAPNoLock(getAPPageIdxNoLock(apIdx, trxType), trxType, [&](const uint8_t* frame) {
+            for (auto pos = startPos; pos < endPos; pos++) {
+                auto elemPosInPage = getAPIdxAndOffsetInAP(header, idxes[pos]).elemPosInPage;
+                memcpy(vals.data() + pos * valSize, frame + elemPosInPage, valSize);
+            }
+        });
+        startPos = endPos;
+    }
+}
+
+void DiskArrayInternal::readAPNoLock(page_idx_t apPageIdx, TransactionType trxType,
+    const std::function<void(uint8_t*)>& readOp) {
     auto& bmFileHandle = (BMFileHandle&)fileHandle;
     if (trxType == TransactionType::READ_ONLY || !hasTransactionalUpdates ||
         apPageIdx > lastPageOnDisk || !bmFileHandle.hasWALPageVersionNoWALPageIdxLock(apPageIdx)) {
-        bufferManager->optimisticRead(bmFileHandle, apPageIdx, [&](const uint8_t* frame) -> void {
-            memcpy(val.data(), frame + apCursor.elemPosInPage, val.size());
-        });
+        bufferManager->optimisticRead(bmFileHandle, apPageIdx, readOp);
     } else {
-        ((BMFileHandle&)fileHandle).acquireWALPageIdxLock(apPageIdx);
-        DBFileUtils::readWALVersionOfPage(bmFileHandle, apPageIdx, *bufferManager, *wal,
-            [&val, &apCursor](const uint8_t* frame) -> void {
-                memcpy(val.data(), frame + apCursor.elemPosInPage, val.size());
-            });
+        bmFileHandle.acquireWALPageIdxLock(apPageIdx);
+        DBFileUtils::readWALVersionOfPage(bmFileHandle, apPageIdx, *bufferManager, *wal, readOp);
     }
 }
 
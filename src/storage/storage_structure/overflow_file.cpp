@@ -199,8 +199,10 @@ void OverflowFile::readFromDisk(transaction::TransactionType trxType, common::pa
 
 void OverflowFile::writePageToDisk(common::page_idx_t pageIdx, uint8_t* data) const {
     if (pageIdx < numPagesOnDisk) {
-        // TODO: updatePage does an unnecessary read + copy. We just want to overwrite
-        DBFileUtils::updatePage(*getBMFileHandle(), dbFileID, pageIdx, false, *bufferManager, *wal,
+        // The whole page is overwritten, so the original page doesn't need to be read into the WAL
+        // version first.
+        DBFileUtils::updatePage(*getBMFileHandle(), dbFileID, pageIdx, true /*isInsertingNewPage*/,
+            *bufferManager, *wal,
             [&](auto* frame) { memcpy(frame, data, BufferPoolConstants::PAGE_4KB_SIZE); });
     } else {
         fileHandle->writePage(data, pageIdx);
@@ -339,10 +339,16 @@ void Column::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx, Colum
             columnChunk->resize(std::bit_ceil(numValuesToScan));
         }
         KU_ASSERT((numValuesToScan + startOffset) <= chunkMetadata.numValues);
+        // Only the pages holding the scanned range are read ahead.
+        auto endPageIdx = cursor.pageIdx;
+        if (numValuesToScan > 0) {
+            endPageIdx += (cursor.elemPosInPage + numValuesToScan - 1) / numValuesPerPage + 1;
+        }
         while (numValuesScanned < numValuesToScan) {
             auto numValuesToReadInPage = std::min(numValuesPerPage - cursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
             KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMetadata));
+            readAheadIfNecessary(transaction, cursor.pageIdx, endPageIdx, chunkMetadata);
             readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
                 readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
                     numValuesToReadInPage, chunkMetadata.compMeta);
@@ -378,6 +384,10 @@ void Column::scanInternal(Transaction* transaction, const ChunkState& state, vec
     const auto startOffsetInChunk = vectorIdx * DEFAULT_VECTOR_CAPACITY;
     auto cursor = getPageCursorForOffsetInGroup(startOffsetInChunk, state);
     if (nodeIDVector->state->getSelVector().isUnfiltered()) {
+        // Node tables scan all vectors of a chunk in order unless nodes are selected by a semi
+        // mask, so the pages up to the end of the chunk are read ahead.
+        readAheadIfNecessary(transaction, cursor.pageIdx,
+            state.metadata.pageIdx + state.metadata.numPages, state.metadata);
         scanUnfiltered(transaction, cursor, numValuesToScan, resultVector, state.metadata);
     } else {
         scanFiltered(transaction, cursor, numValuesToScan, nodeIDVector->state->getSelVector(),
@@ -476,6 +486,37 @@ void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
     bufferManager->optimisticRead(*fileHandleToPin, pageIdxToPin, func);
 }
 
+// Read-ahead is only done by scans reading a range of a chunk page by page, i.e. node table scans
+// and scans into column chunks, so that lookups and scans of a single CSR list or of a few
+// dictionary entries do not load more pages than they read. When such a scan reaches a page that
+// is not cached, the following pages of the range are loaded with the same read. With asynchronous
+// read-ahead, the window after those pages is also read by a background thread while the scan
+// processes the pages that are cached. Only read-only transactions read ahead, as they always read
+// the pages from the original data file, which are all on disk.
+void Column::readAheadIfNecessary(Transaction* transaction, page_idx_t pageIdx,
+    page_idx_t endPageIdx, const ColumnChunkMetadata& chunkMeta) {
+    if (pageIdx == INVALID_PAGE_IDX || !transaction->isReadOnly()) {
+        return;
+    }
+    const auto rangeEndPageIdx =
+        std::min<page_idx_t>(endPageIdx, chunkMeta.pageIdx + chunkMeta.numPages);
+    if (pageIdx >= rangeEndPageIdx) {
+        return;
+    }
+    const auto readAheadNumPages = bufferManager->getReadAheadNumPages();
+    if (readAheadNumPages <= 1) {
+        return;
+    }
+    bufferManager->prefetchPageRange(*dataFH, pageIdx,
+        std::min<uint64_t>(readAheadNumPages, rangeEndPageIdx - pageIdx));
+    if (bufferManager->isAsyncReadAheadEnabled() &&
+        rangeEndPageIdx - pageIdx > readAheadNumPages) {
+        const auto nextWindowPageIdx = pageIdx + readAheadNumPages;
+        bufferManager->prefetchPageRangeAsync(*dataFH, nextWindowPageIdx,
+            std::min<uint64_t>(readAheadNumPages, rangeEndPageIdx - nextWindowPageIdx));
+    }
+}
+
 static bool sanityCheckForWrites(const ColumnChunkMetadata& metadata, const LogicalType& dataType) {
     if (metadata.compMeta.compression == CompressionType::CONSTANT) {
         return metadata.numPages == 0;
@@ -527,11 +568,11 @@ void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t maxIndex,
     // Either both or neither should be provided
     KU_ASSERT((!min && !max) || (min && max));
     if (min && max) {
-        // FIXME(bmwinger): this is causing test failures
         // If new values are outside of the existing min/max, update them
         if (max->gt(metadata.compMeta.max, dataType.getPhysicalType())) {
             metadata.compMeta.max = *max;
-        } else if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
+        }
+        if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
             metadata.compMeta.min = *min;
         }
     }
@@ -546,8 +587,31 @@ void Column::writeValue(ChunkState& state, offset_t offsetInChunk, ValueVector*
         });
 }
 
+// Null entries hold arbitrary values, so they are left out of the statistics.
+template<typename T>
+static std::pair<std::optional<StorageValue>, std::optional<StorageValue>> getTypedMinMax(
+    const T* data, uint64_t offset, uint64_t numValues, const NullMask* nullMask) {
+    std::optional<T> min, max;
+    for (auto i = offset; i < offset + numValues; i++) {
+        if (nullMask && nullMask->isNull(i)) {
+            continue;
+        }
+        if (!min || data[i] < *min) {
+            min = data[i];
+        }
+        if (!max || *max < data[i]) {
+            max = data[i];
+        }
+    }
+    if (!min) {
+        return std::make_pair(std::nullopt, std::nullopt);
+    }
+    return std::make_pair(StorageValue(*min), StorageValue(*max));
+}
+
 inline std::pair<std::optional<StorageValue>, std::optional<StorageValue>> getMinMax(
-    const uint8_t* data, uint64_t numValues, PhysicalTypeID physicalType) {
+    const uint8_t* data, uint64_t offset, uint64_t numValues, PhysicalTypeID physicalType,
+    const NullMask* nullMask) {
     // TODO(bmwinger): STRING and maybe LIST columns should store their offsets in separate columns
     // with actual integer types so that we can store statistics about the values in the main column
     // metadata. This should also simplify some code as we no longer need to sometimes treat those
@@ -558,24 +622,18 @@ inline std::pair<std::optional<StorageValue>, std::optional<StorageValue>> getMi
         [&]<typename T>(T)
             requires(std::integral<T> || std::floating_point<T>)
         {
-            auto typedData = std::span(reinterpret_cast<const T*>(data), numValues);
-            auto [minRaw, maxRaw] = std::minmax_element(typedData.begin(), typedData.end());
-            min = StorageValue(*minRaw);
-            max = StorageValue(*maxRaw);
+            std::tie(min, max) =
+                getTypedMinMax(reinterpret_cast<const T*>(data), offset, numValues, nullMask);
         },
         [&](ku_string_t) {
-            auto typedData = std::span(reinterpret_cast<const uint32_t*>(data), numValues);
-            auto [minRaw, maxRaw] = std::minmax_element(typedData.begin(), typedData.end());
-            min = StorageValue(*minRaw);
-            max = StorageValue(*maxRaw);
+            std::tie(min, max) = getTypedMinMax(reinterpret_cast<const uint32_t*>(data), offset,
+                numValues, nullMask);
         },
         [&]<typename T>(T)
             requires(std::same_as<T, list_entry_t> || std::same_as<T, internalID_t>)
         {
-            auto typedData = std::span(reinterpret_cast<const uint64_t*>(data), numValues);
-            auto [minRaw, maxRaw] = std::minmax_element(typedData.begin(), typedData.end());
-            min = StorageValue(*minRaw);
-            max = StorageValue(*maxRaw);
+            std::tie(min, max) = getTypedMinMax(reinterpret_cast<const uint64_t*>(data), offset,
+                numValues, nullMask);
         },
         [&](auto) {});
     return std::make_pair(min, max);
@@ -592,7 +650,7 @@ void Column::write(ChunkState& state, offset_t offsetInChunk, ColumnChunk* data,
     writeValues(state, offsetInChunk, data->getData(), nullMaskPtr, dataOffset, numValues);
 
     auto [minWritten, maxWritten] =
-        getMinMax(data->getData(), numValues, dataType.getPhysicalType());
+        getMinMax(data->getData(), dataOffset, numValues, dataType.getPhysicalType(), nullMaskPtr);
     updateStatistics(state.metadata, offsetInChunk + numValues - 1, minWritten, maxWritten);
 }
 
@@ -622,7 +680,8 @@ offset_t Column::appendValues(ChunkState& state, const uint8_t* data, const Null
     auto newNumPages = dataFH->getNumPages();
     state.metadata.numPages += (newNumPages - numPages);
 
-    auto [minWritten, maxWritten] = getMinMax(data, numValues, dataType.getPhysicalType());
+    auto [minWritten, maxWritten] =
+        getMinMax(data, 0 /* offset */, numValues, dataType.getPhysicalType(), nullChunkData);
     updateStatistics(state.metadata, startOffset + numValues - 1, minWritten, maxWritten);
     // TODO(bmwinger): it shouldn't be necessary to do this here; it should be handled in
     // prepareCommit
@@ -696,11 +755,14 @@ void Column::prepareCommitForExistingChunk(Transaction* transaction, ChunkState&
     const offset_set_t& deleteInfo) {
     // If this is not a new node group, we should first check if we can perform in-place commit.
     if (canCommitInPlace(state, localInsertChunks, insertInfo, localUpdateChunks, updateInfo)) {
+        auto metadataBeforeCommit = state.metadata;
         commitLocalChunkInPlace(state, localInsertChunks, insertInfo, localUpdateChunks, updateInfo,
             deleteInfo);
         KU_ASSERT(sanityCheckForWrites(state.metadata, dataType));
-        // TODO(bmwinger): avoid updating metadata if it has not changed
-        metadataDA->update(state.nodeGroupIdx, state.metadata);
+        // Updating the metadata shadows its whole disk array page, so skip it if nothing changed.
+        if (state.metadata != metadataBeforeCommit) {
+            metadataDA->update(state.nodeGroupIdx, state.metadata);
+        }
         if (nullColumn) {
             KU_ASSERT(state.nullState);
             auto nullInsertChunks = getNullChunkCollection(localInsertChunks);
@@ -717,9 +779,12 @@ void Column::prepareCommitForExistingChunk(Transaction* transaction, ChunkState&
 void Column::prepareCommitForExistingChunk(Transaction* transaction, ChunkState& state,
     const std::vector<offset_t>& dstOffsets, ColumnChunk* chunk, offset_t startSrcOffset) {
     if (canCommitInPlace(state, dstOffsets, chunk, startSrcOffset)) {
+        auto metadataBeforeCommit = state.metadata;
         commitColumnChunkInPlace(state, dstOffsets, chunk, startSrcOffset);
         KU_ASSERT(sanityCheckForWrites(state.metadata, dataType));
-        metadataDA->update(state.nodeGroupIdx, state.metadata);
+        if (state.metadata != metadataBeforeCommit) {
+            metadataDA->update(state.nodeGroupIdx, state.metadata);
+        }
         if (nullColumn) {
             nullColumn->prepareCommitForExistingChunk(transaction, *state.nullState, dstOffsets,
                 chunk->getNullChunk(), startSrcOffset);
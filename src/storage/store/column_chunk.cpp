@@ -102,10 +102,24 @@ public:
 
     GetCompressionMetadata(const GetCompressionMetadata& other) = default;
 
-    ColumnChunkMetadata operator()(const uint8_t* /*buffer*/, uint64_t /*bufferSize*/,
+    ColumnChunkMetadata operator()(const uint8_t* buffer, uint64_t /*bufferSize*/,
         uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
         auto compMeta = CompressionMetadata(min, max, alg->getCompressionType());
-        if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING) {
+        if (alg->getCompressionType() == CompressionType::ALP) {
+            // Floating point values are only compressed if they are all exactly representable as
+            // decimals with a shared exponent
+            std::optional<CompressionMetadata> alpMeta;
+            if (dataType.getPhysicalType() == PhysicalTypeID::DOUBLE) {
+                alpMeta = FloatCompression<double>::analyze(
+                    reinterpret_cast<const double*>(buffer), numValues, min, max);
+            } else {
+                KU_ASSERT(dataType.getPhysicalType() == PhysicalTypeID::FLOAT);
+                alpMeta = FloatCompression<float>::analyze(reinterpret_cast<const float*>(buffer),
+                    numValues, min, max);
+            }
+            compMeta =
+                alpMeta.value_or(CompressionMetadata(min, max, CompressionType::UNCOMPRESSED));
+        } else if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING) {
             TypeUtils::visit(
                 dataType.getPhysicalType(),
                 [&]<IntegerBitpackingType T>(T) {
@@ -157,6 +171,12 @@ static std::shared_ptr<CompressionAlg> getCompression(const LogicalType& dataTyp
     case PhysicalTypeID::UINT8: {
         return std::make_shared<IntegerBitpacking<uint8_t>>();
     }
+    case PhysicalTypeID::DOUBLE: {
+        return std::make_shared<FloatCompression<double>>();
+    }
+    case PhysicalTypeID::FLOAT: {
+        return std::make_shared<FloatCompression<float>>();
+    }
     default: {
         return std::make_shared<Uncompressed>(dataType);
     }
@@ -205,7 +225,9 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
-    case PhysicalTypeID::INT128: {
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
         auto compression = getCompression(this->dataType, enableCompression);
         flushBufferFunction = CompressedFlushBuffer(compression, this->dataType);
         getMetadataFunction = GetCompressionMetadata(compression, this->dataType);
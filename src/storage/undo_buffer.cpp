@@ -109,9 +109,12 @@ void UndoBuffer::rollback() {
 
 void UndoBuffer::commitEntry(const uint8_t* entry, transaction_t commitTS) {
     auto& catalogEntry = *reinterpret_cast<CatalogEntry* const*>(entry);
+    auto& catalogSet = *reinterpret_cast<CatalogSet* const*>(entry + sizeof(CatalogEntry*));
     auto newCatalogEntry = catalogEntry->getNext();
     KU_ASSERT(newCatalogEntry);
     newCatalogEntry->setTimestamp(commitTS);
+    // The entry becomes visible to other transactions.
+    catalogSet->incrementVersion();
     auto& wal = clientContext.getStorageManager()->getWAL();
     switch (newCatalogEntry->getType()) {
     case CatalogEntryType::NODE_TABLE_ENTRY:
@@ -172,6 +175,7 @@ void UndoBuffer::rollbackEntry(const uint8_t* entry) {
     auto& catalogSet = *reinterpret_cast<CatalogSet* const*>(entry + sizeof(CatalogEntry*));
     auto entryToRollback = catalogEntry->getNext();
     KU_ASSERT(entryToRollback);
+    catalogSet->incrementVersion();
     if (entryToRollback->getNext()) {
         // If entryToRollback has a newer entry (next) in the version chain. Simple remove
         // entryToRollback from the chain.
@@ -16,7 +16,7 @@ namespace storage {
 
 WAL::WAL(const std::string& directory, bool readOnly, BufferManager& bufferManager,
     VirtualFileSystem* vfs, main::ClientContext* context)
-    : directory{directory}, bufferManager{bufferManager}, vfs{vfs} {
+    : directory{directory}, bufferManager{bufferManager}, vfs{vfs}, hasUnsyncedRecords{false} {
     auto fileInfo =
         vfs->openFile(vfs->joinPath(directory, std::string(StorageConstants::WAL_FILE_SUFFIX)),
             readOnly ? O_RDONLY : O_CREAT | O_RDWR, context);
@@ -50,9 +50,8 @@ page_idx_t WAL::logPageInsertRecord(DBFileID dbFileID, page_idx_t pageIdxInOrigi
 
 void WAL::logCommit(uint64_t transactionID) {
     lock_t lck{mtx};
-    // Flush all pages before committing to make sure that commits only show up in the file when
-    // their data is also written.
-    flushAllPages();
+    // The commit record is made durable together with the records and pages before it by the
+    // single flushAllPages() call that follows it.
     CommitRecord walRecord(transactionID);
     addNewWALRecordNoLock(walRecord);
 }
@@ -110,15 +109,21 @@ void WAL::clearWAL() {
 }
 
 void WAL::flushAllPages() {
-    bufferedWriter->flush();
+    // Shadow pages are written before the records referring to them.
     bufferManager.flushAllDirtyPagesInFrames(*shadowingFH);
-    bufferedWriter->getFileInfo().syncFile();
+    bufferedWriter->flush();
+    // Skip the sync if no record was added since the last one. Commit and checkpoint flush the
+    // WAL several times, often without anything new in between.
+    if (hasUnsyncedRecords.exchange(false)) {
+        bufferedWriter->getFileInfo().syncFile();
+    }
 }
 
 void WAL::addNewWALRecordNoLock(WALRecord& walRecord) {
     KU_ASSERT(walRecord.type != WALRecordType::INVALID_RECORD);
     Serializer serializer(bufferedWriter);
     walRecord.serialize(serializer);
+    hasUnsyncedRecords = true;
 }
 
 } // namespace storage
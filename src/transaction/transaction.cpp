@@ -1,17 +1,13 @@
 #include "transaction/transaction.h"
 
-#include "storage/wal/wal.h"
-
 using namespace kuzu::catalog;
 
 namespace kuzu {
 namespace transaction {
 
-void Transaction::commit(storage::WAL* wal) {
+void Transaction::commit() {
     localStorage->prepareCommit();
     undoBuffer->commit(commitTS);
-    wal->logCommit(ID);
-    wal->flushAllPages();
 }
 
 void Transaction::rollback() {
@@ -1,10 +1,14 @@
 #include "transaction/transaction_manager.h"
 
+#include <chrono>
 #include <thread>
 
 #include "common/exception/transaction_manager.h"
+#include "common/types/timestamp_t.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_manager.h"
 #include "storage/wal_replayer.h"
 
@@ -20,6 +24,14 @@ std::unique_ptr<Transaction> TransactionManager::beginTransaction(
     // ensures calls to other public functions is not restricted.
     lock_t newTransactionLck{mtxForStartingNewTransactions};
     lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    // New transactions have to see the last commit, which is only visible once checkpointed.
+    if (!cvForDeferredCheckpoint.wait_for(publicFunctionLck,
+            std::chrono::microseconds(checkpointWaitTimeoutInMicros),
+            [&] { return !hasDeferredCheckpoint; })) {
+        throw TransactionManagerException(
+            "Timeout waiting for active transactions to leave the system before "
+            "checkpointing. If you have an open transaction, please close it and try again.");
+    }
     if (type == TransactionType::WRITE) {
         if (!clientContext.getDBConfig()->enableMultiWrites && hasActiveWriteTransactionNoLock()) {
             throw TransactionManagerException(
@@ -40,17 +52,31 @@ void TransactionManager::commit(main::ClientContext& clientContext, bool skipChe
     auto transaction = clientContext.getTx();
     if (transaction->isReadOnly()) {
         activeReadOnlyTransactionIDs.erase(transaction->getID());
+        checkpointIfDeferredNoLock(clientContext);
         return;
     }
     lastTimestamp++;
     transaction->commitTS = lastTimestamp;
-    transaction->commit(&wal);
+    transaction->commit();
+    // Table statistics are logged before the commit record, so that the commit record and
+    // everything before it become durable with a single flush.
     clientContext.getStorageManager()->prepareCommit(transaction, clientContext.getVFSUnsafe());
+    wal.logCommit(transaction->getID());
     wal.flushAllPages();
     clearActiveWriteTransactionIfWriteTransactionNoLock(transaction);
-    if (!skipCheckPointing) {
-        checkpointNoLock(clientContext);
+    if (skipCheckPointing) {
+        return;
     }
+    // The commit is durable at this point. Instead of stalling the writer until read-only
+    // transactions leave, the checkpoint is done by the last of them to leave. They keep reading
+    // the last checkpointed state in the meantime. Other write transactions still have to leave
+    // first, as their rollback would also undo this commit in the WAL.
+    if (!activeReadOnlyTransactionIDs.empty() && !hasActiveWriteTransactionNoLock()) {
+        hasDeferredCheckpoint = true;
+        deferredCheckpointCommitTime = std::chrono::steady_clock::now();
+        return;
+    }
+    checkpointNoLock(clientContext);
 }
 
 // Note: We take in additional `transaction` here is due to that `transactionContext` might be
@@ -62,6 +88,7 @@ void TransactionManager::rollback(main::ClientContext& clientContext, Transactio
     clientContext.cleanUP();
     if (transaction->isReadOnly()) {
         activeReadOnlyTransactionIDs.erase(transaction->getID());
+        checkpointIfDeferredNoLock(clientContext);
         return;
     }
     clientContext.getStorageManager()->prepareRollback();
@@ -69,6 +96,7 @@ void TransactionManager::rollback(main::ClientContext& clientContext, Transactio
     clearActiveWriteTransactionIfWriteTransactionNoLock(transaction);
     wal.flushAllPages();
     if (!skipCheckPointing) {
+        waitForAsyncReads(clientContext);
         auto walReplayer = std::make_unique<WALReplayer>(clientContext, wal.getShadowingFH(),
             WALReplayMode::ROLLBACK);
         walReplayer->replay();
@@ -121,8 +149,37 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // will only return results or error after all threads working on the tasks of a
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
+    auto startTime = std::chrono::steady_clock::now();
     stopNewTransactionsAndWaitUntilAllTransactionsLeave();
     KU_ASSERT(canCheckpointNoLock());
+    auto waitEndTime = std::chrono::steady_clock::now();
+    replayWALNoLock(clientContext);
+    // Resume receiving new transactions.
+    allowReceivingNewTransactions();
+    // Clear the wal.
+    wal.clearWAL();
+    updateCheckpointStats(startTime, waitEndTime, false /* isDeferred */);
+}
+
+void TransactionManager::checkpointIfDeferredNoLock(main::ClientContext& clientContext) {
+    if (!hasDeferredCheckpoint || !canCheckpointNoLock()) {
+        return;
+    }
+    // New transactions wait for the deferred checkpoint, so there is no need to stop them. They
+    // can only proceed once the checkpoint is done and the lock is released.
+    hasDeferredCheckpoint = false;
+    cvForDeferredCheckpoint.notify_all();
+    auto startTime = std::chrono::steady_clock::now();
+    // The transaction leaving may be on an attached database, so the WAL is replayed with a
+    // context of the local one.
+    main::ClientContext checkpointContext{clientContext.getDatabase()};
+    replayWALNoLock(checkpointContext);
+    wal.clearWAL();
+    updateCheckpointStats(deferredCheckpointCommitTime, startTime, true /* isDeferred */);
+}
+
+void TransactionManager::replayWALNoLock(main::ClientContext& clientContext) {
+    waitForAsyncReads(clientContext);
     clientContext.getCatalog()->prepareCheckpoint(clientContext.getDatabasePath(), &wal,
         clientContext.getVFSUnsafe());
     wal.flushAllPages();
@@ -132,10 +189,32 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     walReplayer->replay();
     // We next perform an in-memory checkpointing of node/relTables.
     clientContext.getStorageManager()->checkpointInMemory();
-    // Resume receiving new transactions.
-    allowReceivingNewTransactions();
-    // Clear the wal.
-    wal.clearWAL();
+}
+
+// Pages read ahead in the background stay LOCKED until they are read, but WAL replay updates the
+// frames of cached pages without locking them, so the reads still in flight, e.g. of a scan that
+// completed before reading them, are waited for first.
+void TransactionManager::waitForAsyncReads(main::ClientContext& clientContext) {
+    clientContext.getMemoryManager()->getBufferManager()->waitForAsyncReads();
+}
+
+void TransactionManager::updateCheckpointStats(std::chrono::steady_clock::time_point startTime,
+    std::chrono::steady_clock::time_point waitEndTime, bool isDeferred) {
+    auto endTime = std::chrono::steady_clock::now();
+    auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+    auto waitDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(waitEndTime - startTime).count();
+    std::unique_lock<std::mutex> lck{mtxForCheckpointStats};
+    checkpointStats.numCheckpoints++;
+    if (isDeferred) {
+        checkpointStats.numDeferredCheckpoints++;
+    }
+    checkpointStats.lastDuration = duration;
+    checkpointStats.maxDuration = std::max<uint64_t>(checkpointStats.maxDuration, duration);
+    checkpointStats.totalDuration += duration;
+    checkpointStats.totalWaitDuration += waitDuration;
+    checkpointStats.lastCheckpointTS = Timestamp::getCurrentTimestamp().value;
 }
 
 void TransactionManager::clearActiveWriteTransactionIfWriteTransactionNoLock(
@@ -0,0 +1,39 @@
+#include <thread>
+#include <vector>
+
+#include "common/task_system/progress_bar.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+
+// Independent pipelines of a query may finish at the same time on different worker threads.
+TEST(ProgressBarTests, TestFinishPipelinesConcurrently) {
+    constexpr auto numThreads = 8u;
+    constexpr auto numPipelinesPerThread = 200u;
+    ProgressBar progressBar;
+    progressBar.toggleProgressBarPrinting(true);
+    progressBar.setShowProgressAfter(0);
+    for (auto i = 0u; i < numThreads * numPipelinesPerThread; i++) {
+        progressBar.addPipeline();
+    }
+    testing::internal::CaptureStdout();
+    progressBar.startProgress();
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < numThreads; i++) {
+        threads.emplace_back([&]() {
+            for (auto j = 0u; j < numPipelinesPerThread; j++) {
+                progressBar.finishPipeline();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    progressBar.endProgress();
+    // The last pipeline to finish prints the progress bar, and no finished pipeline is lost.
+    auto lastPrint = output.rfind("Pipelines Finished: ");
+    ASSERT_NE(lastPrint, std::string::npos);
+    ASSERT_EQ(output.substr(lastPrint, output.find('\n', lastPrint) - lastPrint),
+        "Pipelines Finished: 100%");
+}
@@ -43,3 +43,44 @@ TEST_F(RDFArrowTest, getRDFArrowResult) {
             "Runtime exception: Unsupported type: RDF_VARIANT for arrow conversion.");
     }
 }
+
+TEST_F(ArrowTest, getArrowResultByColumns) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.fName, a.workedHours ORDER BY a.ID";
+    auto result = conn->query(query);
+    // Row by row and arrow reads share the same position in the result.
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    auto arrowArray = result->getNextArrowChunk(3);
+    ASSERT_EQ(arrowArray->length, 3);
+    ASSERT_EQ(arrowArray->n_children, 3);
+    auto ids = (const int64_t*)arrowArray->children[0]->buffers[1];
+    ASSERT_EQ(ids[0], 2);
+    ASSERT_EQ(ids[1], 3);
+    ASSERT_EQ(ids[2], 5);
+    auto nameOffsets = (const int32_t*)arrowArray->children[1]->buffers[1];
+    auto names = (const char*)arrowArray->children[1]->buffers[2];
+    ASSERT_EQ(std::string(names + nameOffsets[1], nameOffsets[2] - nameOffsets[1]), "Carol");
+    auto hours = arrowArray->children[2];
+    auto hourOffsets = (const int32_t*)hours->buffers[1];
+    auto hourValues = (const int64_t*)hours->children[0]->buffers[1];
+    ASSERT_EQ(hourOffsets[3] - hourOffsets[2], 2);
+    ASSERT_EQ(hourValues[hourOffsets[2]], 1);
+    ASSERT_EQ(hourValues[hourOffsets[2] + 1], 9);
+    arrowArray->release(arrowArray.get());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 7);
+}
+
+TEST_F(ArrowTest, getArrowResultStreamed) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true")->isSuccess());
+    auto result = conn->query("UNWIND range(0, 9999) AS i RETURN i");
+    // Each arrow chunk spans several chunks of the streamed result.
+    for (auto chunkIdx = 0; chunkIdx < 2; chunkIdx++) {
+        auto arrowArray = result->getNextArrowChunk(5000);
+        ASSERT_EQ(arrowArray->length, 5000);
+        auto values = (const int64_t*)arrowArray->children[0]->buffers[1];
+        for (auto i = 0; i < 5000; i++) {
+            ASSERT_EQ(values[i], chunkIdx * 5000 + i);
+        }
+        arrowArray->release(arrowArray.get());
+    }
+    ASSERT_FALSE(result->hasNext());
+}
@@ -4,6 +4,7 @@
 #include <windows.h>
 #endif
 
+#include "common/exception/runtime.h"
 #include "main_test_helper/main_test_helper.h"
 
 using namespace kuzu::common;
@@ -94,6 +95,66 @@ TEST_F(ApiTest, TimeOut) {
     ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
 }
 
+TEST_F(ApiTest, StreamingResult) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true")->isSuccess());
+    auto result = conn->query("UNWIND range(0, 99999) AS i RETURN i");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_THROW(result->getNumTuples(), RuntimeException);
+    auto expected = 0;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected++);
+    }
+    ASSERT_EQ(expected, 100000);
+    ASSERT_EQ(result->getNumTuples(), 100000);
+    auto summary = result->getQuerySummary();
+    ASSERT_LE(summary->getTimeToFirstTuple(), summary->getExecutionTime());
+}
+
+TEST_F(ApiTest, StreamingResultClosedByNextQuery) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true")->isSuccess());
+    auto result = conn->query("UNWIND range(0, 99999) AS i RETURN i");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    // The query is interrupted if it is still running. Otherwise its result stays readable.
+    if (!result->isSuccess()) {
+        ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
+        return;
+    }
+    auto expected = 1;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected++);
+    }
+    ASSERT_EQ(expected, 100000);
+}
+
+TEST_F(ApiTest, StreamingResultNotRead) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_result=true")->isSuccess());
+    // Most of the result does not fit in the chunk queue and is spilled, so the query completes
+    // without its result being read.
+    auto result = conn->query("UNWIND range(0, 99999) AS i RETURN i, concat('a string too long to "
+                              "be inlined ', cast(i, 'STRING')), [i, i + 1]");
+    ASSERT_TRUE(result->isSuccess());
+    // The checkpoint of the write is deferred while the streaming query runs, and the next
+    // transaction waits for it.
+    auto conn2 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn2->query("CREATE (:person {ID: 100})")->isSuccess());
+    auto countResult = conn2->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_TRUE(countResult->isSuccess()) << countResult->getErrorMessage();
+    ASSERT_EQ(countResult->getNext()->getValue(0)->getValue<int64_t>(), 9);
+    auto expected = 0;
+    while (result->hasNext()) {
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), expected);
+        ASSERT_EQ(tuple->getValue(1)->getValue<std::string>(),
+            "a string too long to be inlined " + std::to_string(expected));
+        ASSERT_EQ(tuple->getValue(2)->toString(),
+            "[" + std::to_string(expected) + "," + std::to_string(expected + 1) + "]");
+        expected++;
+    }
+    ASSERT_EQ(expected, 100000);
+    ASSERT_EQ(result->getNumTuples(), 100000);
+}
+
 TEST_F(ApiTest, MultipleQueryExplain) {
     auto result = conn->query("EXPLAIN MATCH (a:person)-[:knows]->(b:person), "
                               "(b)-[:knows]->(a) RETURN a.fName, b.fName ORDER BY a.ID; MATCH "
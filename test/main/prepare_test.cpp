@@ -242,3 +242,26 @@ TEST_F(ApiTest, PrepareExport) {
     auto result = conn->execute(preparedStatement.get());
     ASSERT_TRUE(result->isSuccess());
 }
+
+TEST_F(ApiTest, PreparedStatementPlanCache) {
+    auto preparedStatement =
+        conn->prepare("MATCH (a:person) WHERE a.fName STARTS WITH $n RETURN a.ID, a.fName");
+    auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "A"));
+    ASSERT_FALSE(result->getQuerySummary()->isPlanCacheHit());
+    ASSERT_EQ(std::vector<std::string>{"0|Alice"}, TestHelper::convertResultToString(*result));
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "B"));
+    ASSERT_TRUE(result->getQuerySummary()->isPlanCacheHit());
+    ASSERT_EQ(std::vector<std::string>{"2|Bob"}, TestHelper::convertResultToString(*result));
+    // A different parameter type requires rebinding.
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), (int64_t)36));
+    ASSERT_FALSE(result->getQuerySummary()->isPlanCacheHit());
+    ASSERT_TRUE(result->isSuccess());
+    // Catalog changes invalidate the cached plan.
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD nickname STRING")->isSuccess());
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "C"));
+    ASSERT_FALSE(result->getQuerySummary()->isPlanCacheHit());
+    ASSERT_EQ(std::vector<std::string>{"3|Carol"}, TestHelper::convertResultToString(*result));
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "D"));
+    ASSERT_TRUE(result->getQuerySummary()->isPlanCacheHit());
+    ASSERT_EQ(std::vector<std::string>{"5|Dan"}, TestHelper::convertResultToString(*result));
+}
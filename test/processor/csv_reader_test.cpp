@@ -0,0 +1,61 @@
+#include <string>
+
+#include "gtest/gtest.h"
+#include "processor/operator/persistent/reader/csv/base_csv_reader.h"
+
+using namespace kuzu::processor;
+
+static uint64_t findFirstOf(const std::string& str, uint64_t position = 0) {
+    return BaseCSVReader::findFirstOf(str.data(), position, str.size(), ',', '\n', '\r');
+}
+
+TEST(CSVReaderTest, FindFirstOfInEachByteLane) {
+    for (auto c : {',', '\n', '\r'}) {
+        for (auto i = 0u; i < 24; i++) {
+            std::string str(24, 'a');
+            str[i] = c;
+            EXPECT_EQ(findFirstOf(str), i);
+            // Later matches in the same word are ignored.
+            if (i + 1 < str.size()) {
+                str[i + 1] = ',';
+            }
+            EXPECT_EQ(findFirstOf(str), i);
+        }
+    }
+}
+
+TEST(CSVReaderTest, FindFirstOfInTail) {
+    for (auto length = 1u; length < 8; length++) {
+        std::string str(length, 'a');
+        EXPECT_EQ(findFirstOf(str), length);
+        for (auto i = 0u; i < length; i++) {
+            std::string matched = str;
+            matched[i] = '\n';
+            EXPECT_EQ(findFirstOf(matched), i);
+        }
+    }
+    // A tail after full words.
+    for (auto length = 9u; length < 16; length++) {
+        std::string str(length, 'a');
+        EXPECT_EQ(findFirstOf(str), length);
+        str[length - 1] = '\r';
+        EXPECT_EQ(findFirstOf(str), length - 1);
+    }
+}
+
+TEST(CSVReaderTest, FindFirstOfFromUnalignedPosition) {
+    std::string str = "a,aaaaaaaaaaaa,aaaa";
+    for (auto position = 2u; position <= 14; position++) {
+        EXPECT_EQ(findFirstOf(str, position), 14);
+    }
+    EXPECT_EQ(findFirstOf(str, 15), str.size());
+    EXPECT_EQ(findFirstOf(str, str.size()), str.size());
+}
+
+TEST(CSVReaderTest, FindFirstOfNearMatches) {
+    // Bytes that differ from the searched characters only in their lowest or highest bit.
+    std::string str = "-\x0B\x0C\xAC\x8A\x8D+\x0B\x0C-\xAC";
+    EXPECT_EQ(findFirstOf(str), str.size());
+    str += ',';
+    EXPECT_EQ(findFirstOf(str), str.size() - 1);
+}
@@ -0,0 +1,51 @@
+#include <regex>
+
+#include "main_test_helper/main_test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class SpillTest : public ApiTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->bufferPoolSize = 32 * 1024 * 1024;
+        createDBAndConn();
+        initGraph();
+    }
+
+    // Sum of a profiler attribute over all operators of the profiled query.
+    uint64_t getProfiledAttribute(const std::string& query, const std::string& attribute) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto profile = result->getNext()->getValue(0)->toString();
+        std::regex pattern{attribute + ": ([0-9]+)"};
+        uint64_t sum = 0;
+        for (auto it = std::sregex_iterator(profile.begin(), profile.end(), pattern);
+             it != std::sregex_iterator(); ++it) {
+            sum += std::stoull((*it)[1].str());
+        }
+        return sum;
+    }
+};
+
+TEST_F(SpillTest, AggregateHashTable) {
+    auto query = "UNWIND range(1, 400000) AS x WITH x % 200000 AS k, COUNT(*) AS c, SUM(x) AS s, "
+                 "AVG(x) AS a, MIN(x) AS m RETURN COUNT(*)";
+    ASSERT_GT(getProfiledAttribute(query, "SpilledBytes"), 0);
+    auto result = conn->query("UNWIND range(1, 400000) AS x WITH x % 200000 AS k, COUNT(*) AS c, "
+                              "SUM(x) AS s, AVG(x) AS a, MIN(x) AS m WHERE k = 7 RETURN c, s, a, m");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->toString(), "c|s|a|m\n2|200014|100007.000000|7\n");
+}
+
+TEST_F(SpillTest, HashJoinBuild) {
+    // Build tuples hold long strings and nested values, which are spilled out of line.
+    auto query = "MATCH (a:person), (b:person) WHERE a.fName = b.fName RETURN a.ID, b.fName, "
+                 "b.workedHours, b.courseScoresPerTerm, b.grades ORDER BY a.ID";
+    auto expected = conn->query(query)->toString();
+    ASSERT_EQ(getProfiledAttribute(query, "SpilledTuples"), 0);
+    ASSERT_TRUE(conn->query("CALL hash_join_memory_limit=1")->isSuccess());
+    ASSERT_GT(getProfiledAttribute(query, "SpilledTuples"), 0);
+    ASSERT_EQ(conn->query(query)->toString(), expected);
+}
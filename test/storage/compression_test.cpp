@@ -296,3 +296,82 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+template<typename T>
+void floatCompressionMultiPage(const std::vector<T>& src) {
+    auto alg = FloatCompression<T>();
+    auto pageSize = 4096;
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto analyzed = FloatCompression<T>::analyze(src.data(), src.size(), StorageValue(*min),
+        StorageValue(*max));
+    ASSERT_TRUE(analyzed.has_value());
+    auto metadata = *analyzed;
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    auto logicalType =
+        LogicalType(std::same_as<T, double> ? LogicalTypeID::DOUBLE : LogicalTypeID::FLOAT);
+    auto numValuesPerPage = metadata.numValues(pageSize, logicalType);
+    // Compression must save space compared to storing the values uncompressed
+    ASSERT_GT(numValuesPerPage, pageSize / sizeof(T));
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        alg.compressNextPage(srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize,
+            metadata);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+
+    // Values within the range that share the exponent can be updated in place
+    T value = src[src.size() / 2];
+    ASSERT_TRUE(FloatCompression<T>::canUpdateInPlace(value, metadata));
+    alg.setValuesFromUncompressed((uint8_t*)&value, 0 /*srcOffset*/, dest[0].data(),
+        1 /*dstOffset*/, 1 /*numValues*/, metadata, nullptr /*nullMask*/);
+    T result;
+    alg.decompressFromPage(dest[0].data(), 1 /*srcOffset*/, (uint8_t*)&result, 0 /*dstOffset*/,
+        1 /*numValues*/, metadata);
+    EXPECT_EQ(result, value);
+    EXPECT_FALSE(FloatCompression<T>::canUpdateInPlace((T)0.123456789, metadata));
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageDouble) {
+    int64_t numValues = 10000;
+    std::vector<double> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i % 2000 - 1000) / 100.0;
+    }
+
+    floatCompressionMultiPage(src);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageFloat) {
+    int64_t numValues = 10000;
+    std::vector<float> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (float)(i % 500) / 10.0f;
+    }
+
+    floatCompressionMultiPage(src);
+}
+
+TEST(CompressionTests, FloatCompressionRejectsNonDecimalValues) {
+    std::vector<double> src{1.5, 2.25, 1.0 / 3.0};
+    EXPECT_FALSE(FloatCompression<double>::analyze(src.data(), src.size(), StorageValue(1.0 / 3.0),
+        StorageValue(2.25))
+                     .has_value());
+    // -0.0 would be decoded as 0.0
+    src = {1.5, -0.0};
+    EXPECT_FALSE(FloatCompression<double>::analyze(src.data(), src.size(), StorageValue(-0.0),
+        StorageValue(1.5))
+                     .has_value());
+}
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "common/file_system/local_file_system.h"
+#include "common/string_format.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class EvictionPolicyTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        // Copying the cold tables needs a larger buffer pool than the default one for testing.
+        systemConfig->bufferPoolSize = 256 * 1024 * 1024;
+        createDBAndConn();
+        auto tempDir = TestHelper::getTempDir(getTestGroupAndName());
+        std::filesystem::create_directories(tempDir);
+        auto filePath = LocalFileSystem::joinPath(tempDir, "cold.csv");
+#if defined(_WIN32)
+        std::replace(filePath.begin(), filePath.end(), '\\', '/');
+#endif
+        std::ofstream file(filePath);
+        coldSum = 0;
+        for (auto i = 0u; i < NUM_COLD_NODES; i++) {
+            // Hashed values do not compress, so the cold tables take as many pages as they hold.
+            auto v = (int64_t)((i * 0x9E3779B97F4A7C15ull) >> 24);
+            coldSum += v;
+            file << i << ',' << v << '\n';
+        }
+        file.close();
+        execute("CREATE NODE TABLE Hot(id INT64, v INT64, PRIMARY KEY(id))");
+        execute("UNWIND range(0, 999) AS i CREATE (:Hot {id: i, v: i * 2})");
+        for (auto i = 0u; i < NUM_COLD_TABLES; i++) {
+            execute(
+                stringFormat("CREATE NODE TABLE Cold{}(id INT64, v INT64, PRIMARY KEY(id))", i));
+            execute(stringFormat("COPY Cold{} FROM '{}'", i, filePath));
+        }
+    }
+
+    // Reopens the database with a buffer pool that is less than half as large as the cold tables
+    // together.
+    void reopenWithSmallBufferPool(bool scanResistantEviction) {
+        conn.reset();
+        systemConfig->bufferPoolSize = 8 * 1024 * 1024;
+        systemConfig->scanResistantEviction = scanResistantEviction;
+        createDBAndConn();
+    }
+
+    void execute(const std::string& query) {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+    }
+
+    void scanHot() {
+        auto result = conn->query("MATCH (h:Hot) RETURN SUM(h.v)");
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 999000);
+    }
+
+    void scanCold(uint64_t tableIdx) {
+        auto result = conn->query(stringFormat("MATCH (c:Cold{}) RETURN SUM(c.v)", tableIdx));
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), coldSum);
+    }
+
+    int64_t getBufferManagerInfo(const std::string& column) {
+        auto result = conn->query("CALL buffer_manager_info() RETURN " + column);
+        EXPECT_TRUE(result->isSuccess()) << result->toString();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+
+    std::string getEvictionPolicy() {
+        auto result = conn->query("CALL buffer_manager_info() RETURN eviction_policy");
+        EXPECT_TRUE(result->isSuccess()) << result->toString();
+        return result->getNext()->getValue(0)->getValue<std::string>();
+    }
+
+    static constexpr uint64_t NUM_COLD_NODES = 1000000;
+    static constexpr uint64_t NUM_COLD_TABLES = 4;
+
+    int64_t coldSum;
+};
+
+TEST_F(EvictionPolicyTest, FIFOEviction) {
+    reopenWithSmallBufferPool(false /* scanResistantEviction */);
+    ASSERT_EQ(getEvictionPolicy(), "FIFO");
+    for (auto i = 0u; i < 2 * NUM_COLD_TABLES; i++) {
+        scanHot();
+        scanCold(i % NUM_COLD_TABLES);
+    }
+    ASSERT_GT(getBufferManagerInfo("num_evictions"), 0);
+    ASSERT_GT(getBufferManagerInfo("num_page_accesses"),
+        getBufferManagerInfo("num_page_reads"));
+}
+
+// The pages of the hot table are accessed between the scans of the cold tables, so they move to the
+// main queue and stay cached while later scans, which do not fit in the buffer pool, recycle the
+// probation queue.
+TEST_F(EvictionPolicyTest, ScanResistantEviction) {
+    reopenWithSmallBufferPool(true /* scanResistantEviction */);
+    ASSERT_EQ(getEvictionPolicy(), "SCAN_RESISTANT");
+    // A page moves to the main queue once it is accessed in two passes over the probation queue.
+    for (auto i = 0u; i < 4 * NUM_COLD_TABLES; i++) {
+        scanHot();
+        scanCold(i % NUM_COLD_TABLES);
+    }
+    ASSERT_GT(getBufferManagerInfo("num_evictions"), 0);
+    // The cold tables together are more than twice as large as the buffer pool, so a FIFO queue
+    // would evict the pages of the hot table even after giving them a second chance.
+    for (auto i = 0u; i < NUM_COLD_TABLES; i++) {
+        scanCold(i);
+    }
+    auto numPageReads = getBufferManagerInfo("num_page_reads");
+    scanHot();
+    ASSERT_EQ(getBufferManagerInfo("num_page_reads"), numPageReads);
+}
@@ -0,0 +1,53 @@
+#include "catalog/catalog.h"
+#include "graph_test/graph_test.h"
+#include "storage/index/hash_index.h"
+#include "storage/storage_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class PrimaryKeyIndexTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    void execute(const std::string& query) {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+};
+
+TEST_F(PrimaryKeyIndexTest, LookupBatch) {
+    execute("CREATE NODE TABLE N(id INT64, PRIMARY KEY (id))");
+    execute("COPY N FROM (UNWIND range(0, 9999) AS i RETURN i)");
+    // Keys created or deleted by the transaction are only in the local storage of the index.
+    execute("BEGIN TRANSACTION");
+    execute("UNWIND range(10000, 10099) AS i CREATE (:N {id: i})");
+    execute("MATCH (n:N) WHERE n.id = 5 OR n.id = 10010 DELETE n");
+    auto transaction = conn->getClientContext()->getTx();
+    auto tableID = getCatalog(*database)->getTableID(transaction, "N");
+    auto pkIndex = getStorageManager(*database)->getPKIndex(tableID);
+    // Persistent, deleted, local, missing and repeated keys, followed by a null key.
+    std::vector<int64_t> keys{0, 5, 9999, 10000, 10010, 10099, 20000, -1, 7, 10050, 7, 4321};
+    std::vector<bool> found{true, false, true, true, false, true, false, false, true, true, true,
+        true};
+    ValueVector keyVector{LogicalType{LogicalTypeID::INT64}, getMemoryManager(*database)};
+    keyVector.setState(std::make_shared<DataChunkState>());
+    for (auto i = 0u; i < keys.size(); i++) {
+        keyVector.setValue<int64_t>(i, keys[i]);
+    }
+    keyVector.setNull(keys.size(), true);
+    keyVector.state->getSelVectorUnsafe().setSelSize(keys.size() + 1);
+    std::vector<offset_t> results(keys.size() + 1);
+    pkIndex->lookupBatch(transaction, &keyVector, results.data());
+    for (auto i = 0u; i < keys.size(); i++) {
+        offset_t expected = INVALID_OFFSET;
+        ASSERT_EQ(pkIndex->lookup(transaction, &keyVector, i, expected), found[i]) << keys[i];
+        ASSERT_EQ(results[i], found[i] ? expected : INVALID_OFFSET) << keys[i];
+    }
+    ASSERT_EQ(results[keys.size()], INVALID_OFFSET);
+    ASSERT_EQ(results[8], results[10]);
+    execute("ROLLBACK");
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "common/file_system/local_file_system.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class ReadAheadTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        systemConfig->bufferPoolSize = 256 * 1024 * 1024;
+        createDBAndConn();
+        auto tempDir = TestHelper::getTempDir(getTestGroupAndName());
+        std::filesystem::create_directories(tempDir);
+        auto nodeFilePath = LocalFileSystem::joinPath(tempDir, "nodes.csv");
+        auto relFilePath = LocalFileSystem::joinPath(tempDir, "rels.csv");
+#if defined(_WIN32)
+        std::replace(nodeFilePath.begin(), nodeFilePath.end(), '\\', '/');
+        std::replace(relFilePath.begin(), relFilePath.end(), '\\', '/');
+#endif
+        std::ofstream nodeFile(nodeFilePath);
+        std::ofstream relFile(relFilePath);
+        vSum = 0;
+        for (auto i = 0u; i < NUM_NODES; i++) {
+            // Hashed values do not compress, so the columns take many pages.
+            auto v = (int64_t)((i * 0x9E3779B97F4A7C15ull) >> 24);
+            vSum += v;
+            nodeFile << i << ',' << v << '\n';
+            for (auto j = 1u; j <= NUM_RELS_PER_NODE; j++) {
+                relFile << i << ',' << (i * j * 7919 + j) % NUM_NODES << ',' << v + j << '\n';
+            }
+        }
+        nodeFile.close();
+        relFile.close();
+        execute("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id))");
+        execute("CREATE REL TABLE R(FROM T TO T, w INT64)");
+        execute("COPY T FROM '" + nodeFilePath + "'");
+        execute("COPY R FROM '" + relFilePath + "'");
+    }
+
+    void reopen(uint64_t readAheadNumPages, bool asyncReadAhead = false) {
+        conn.reset();
+        systemConfig->readAheadNumPages = readAheadNumPages;
+        systemConfig->asyncReadAhead = asyncReadAhead;
+        createDBAndConn();
+    }
+
+    void execute(const std::string& query) {
+        auto result = conn->query(query);
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+    }
+
+    int64_t getBufferManagerInfo(const std::string& column) {
+        auto result = conn->query("CALL buffer_manager_info() RETURN " + column);
+        EXPECT_TRUE(result->isSuccess()) << result->toString();
+        return result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+
+    int64_t getNumPageReads() { return getBufferManagerInfo("num_page_reads"); }
+
+    void checkNodeScan(uint64_t numNodes) {
+        auto result = conn->query("MATCH (t:T) RETURN COUNT(*), SUM(t.v)");
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), numNodes);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), vSum);
+    }
+
+    // Returns the number of pages read by the lookup of the rels of a single node.
+    int64_t lookUpRels() {
+        auto numPageReads = getNumPageReads();
+        auto result = conn->query("MATCH (a:T)-[r:R]->(b:T) WHERE a.id = 12345 RETURN COUNT(*)");
+        EXPECT_TRUE(result->isSuccess()) << result->toString();
+        EXPECT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), NUM_RELS_PER_NODE);
+        return getNumPageReads() - numPageReads;
+    }
+
+    static constexpr uint64_t NUM_NODES = 200000;
+    static constexpr uint64_t NUM_RELS_PER_NODE = 3;
+
+    int64_t vSum;
+};
+
+TEST_F(ReadAheadTest, ColdScans) {
+    for (auto readAheadNumPages : {0u, 1u, 4u, 100000u}) {
+        reopen(readAheadNumPages);
+        checkNodeScan(NUM_NODES);
+        auto result = conn->query("MATCH (a:T)-[r:R]->(b:T) RETURN COUNT(*), SUM(r.w - a.v)");
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), NUM_NODES * NUM_RELS_PER_NODE);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), NUM_NODES * 6);
+    }
+}
+
+// A lookup only reads ahead within the ranges it reads anyway, so it reads as many pages as without
+// read-ahead however large the read-ahead window is.
+TEST_F(ReadAheadTest, LookupsDoNotReadAhead) {
+    reopen(0 /* readAheadNumPages */);
+    auto numPageReadsWithoutReadAhead = lookUpRels();
+    reopen(100000 /* readAheadNumPages */);
+    ASSERT_EQ(lookUpRels(), numPageReadsWithoutReadAhead);
+}
+
+// The windows following the first one of a chunk are read by the background threads. The commit
+// right after the scan checkpoints while some of these reads may still be in flight.
+TEST_F(ReadAheadTest, ColdScanWithAsyncReadAhead) {
+    reopen(4 /* readAheadNumPages */, true /* asyncReadAhead */);
+    checkNodeScan(NUM_NODES);
+    auto numAsyncPageReads = getBufferManagerInfo("num_async_page_reads");
+    ASSERT_GT(numAsyncPageReads, 0);
+    ASSERT_LE(numAsyncPageReads, getNumPageReads());
+    execute("CREATE (:T {id: " + std::to_string(NUM_NODES) + ", v: 0})");
+    checkNodeScan(NUM_NODES + 1);
+    reopen(4 /* readAheadNumPages */, true /* asyncReadAhead */);
+    checkNodeScan(NUM_NODES + 1);
+}
+
+TEST_F(ReadAheadTest, NoAsyncReadsWhenDisabled) {
+    reopen(4 /* readAheadNumPages */);
+    checkNodeScan(NUM_NODES);
+    ASSERT_EQ(getBufferManagerInfo("num_async_page_reads"), 0);
+}
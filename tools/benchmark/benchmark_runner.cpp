@@ -15,8 +15,9 @@ const char* BENCHMARK_SUFFIX = ".benchmark";
 BenchmarkRunner::BenchmarkRunner(const std::string& datasetPath,
     std::unique_ptr<BenchmarkConfig> config)
     : config{std::move(config)} {
-    database = std::make_unique<Database>(datasetPath,
-        SystemConfig(this->config->bufferPoolSize, this->config->numThreads));
+    auto systemConfig = SystemConfig(this->config->bufferPoolSize, this->config->numThreads);
+    systemConfig.asyncReadAhead = this->config->asyncReadAhead;
+    database = std::make_unique<Database>(datasetPath, systemConfig);
     spdlog::set_level(spdlog::level::debug);
 }
 
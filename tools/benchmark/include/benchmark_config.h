@@ -20,6 +20,8 @@ struct BenchmarkConfig {
     // output benchmark log to file
     std::string outputPath;
     uint64_t bufferPoolSize = 1 << 23;
+    // read the pages of column scans ahead with background threads
+    bool asyncReadAhead = false;
 };
 
 } // namespace benchmark
@@ -36,6 +36,8 @@ int main(int argc, char** argv) {
             config->enableProfile = true;
         } else if (arg.starts_with("--bm-size")) {
             config->bufferPoolSize = (uint64_t)stoull(getArgumentValue(arg)) << 20;
+        } else if (arg.starts_with("--async-read-ahead")) {
+            config->asyncReadAhead = true;
         } else {
             printf("Unrecognized option %s", arg.c_str());
             return 1;